@@ -241,6 +241,178 @@ int main() {
 		string = Power::String::ToString(std::numeric_limits<int16_t>::min());
 		printf("String: %s|\n", string.CString());
 
+		Power::String report;
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			report += static_cast<uint32_t>(i) * 2654435761u;
+			report += ';';
+			report += -static_cast<int64_t>(i) * 1000003;
+			report += '\n';
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Numeric report row average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		report = "";
+		for (int i = 0; i < measureCount; ++i) {
+			double value = (i + 1) * 1.2345678901234567;
+			uint64_t startCount = __rdtsc();
+			report += value;
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Shortest double average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		char doubleBuffer[32];
+		for (int i = 0; i < measureCount; ++i) {
+			double value = (i + 1) * 1.2345678901234567;
+			uint64_t startCount = __rdtsc();
+			snprintf(doubleBuffer, sizeof(doubleBuffer), "%.17g", value);
+			report += doubleBuffer;
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("snprintf %%.17g double average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		report = "";
+		for (int i = 0; i < measureCount; ++i) {
+			report += (i + 1) * 1.2345678901234567;
+			report += '\n';
+		}
+		double columnSum = 0.0;
+		uint64_t startParse = __rdtsc();
+		for (size_t position = 0; position < report.Size();) {
+			double value = 0.0;
+			position += report.View(position, report.Size()).TryParseDouble(value).consumed + 1;
+			columnSum += value;
+		}
+		uint64_t endParse = __rdtsc();
+
+		printf("Numeric column parse cycles per byte: %.2f (sum %g)\n", static_cast<double>(endParse - startParse) / report.Size(), columnSum);
+
+		size_t lineSizes = 0;
+		startParse = __rdtsc();
+		for (int32_t position = 0, end = report.IndexOf('\n'); end >= 0; position = end + 1, end = report.IndexOf('\n', position)) {
+			lineSizes += report.Substring(position, end).Size();
+		}
+		endParse = __rdtsc();
+		printf("IndexOf and Substring lines cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / report.Size(), lineSizes);
+
+		lineSizes = 0;
+		startParse = __rdtsc();
+		for (const Power::StringView& line : report.Split('\n')) lineSizes += line.Size();
+		endParse = __rdtsc();
+		printf("Split lines cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / report.Size(), lineSizes);
+
+		lineSizes = 0;
+		startParse = __rdtsc();
+		for (const Power::StringView& line : report.Lines()) lineSizes += line.Size();
+		endParse = __rdtsc();
+		printf("Lines cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / report.Size(), lineSizes);
+
+		FILE* reportFile = tmpfile();
+		if (reportFile != nullptr) {
+			fwrite(report.CString(), 1, report.Size(), reportFile);
+			rewind(reportFile);
+			Power::LineReader reader(reportFile);
+			Power::String line;
+			lineSizes = 0;
+			startParse = __rdtsc();
+			while (reader.ReadLine(line)) lineSizes += line.Size();
+			endParse = __rdtsc();
+			printf("LineReader ReadLine cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / report.Size(), lineSizes);
+			fclose(reportFile);
+		}
+
+		Power::String csv;
+		for (int i = 0; i < 100000; ++i) csv.AppendAll(i, ",\"Doe, Jane\",", i * 0.25, ",\"said \"\"hi\"\"\",ok\n");
+		{
+			Power::CsvReader reader(csv.View());
+			Power::CsvRow row;
+			size_t fieldSizes = 0;
+			startParse = __rdtsc();
+			while (reader.ReadRow(row)) {
+				for (size_t i = 0; i < row.Size(); ++i) fieldSizes += row[i].Size();
+			}
+			endParse = __rdtsc();
+			printf("CsvReader cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / csv.Size(), fieldSizes);
+		}
+		{
+			size_t fieldSizes = 0;
+			size_t fieldSize = 0;
+			bool inQuote = false;
+			startParse = __rdtsc();
+			for (size_t i = 0; i < csv.Size(); ++i) {
+				char c = csv[i];
+				if (c == '"') inQuote = !inQuote;
+				else if (!inQuote && (c == ',' || c == '\n')) {
+					fieldSizes += fieldSize;
+					fieldSize = 0;
+				}
+				else ++fieldSize;
+			}
+			endParse = __rdtsc();
+			printf("Byte by byte quote and delimiter scan cycles per byte: %.2f (sum %zd)\n", static_cast<double>(endParse - startParse) / csv.Size(), fieldSizes);
+		}
+
+		Power::String logName("loader");
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			Power::String line = logName + ": ";
+			line += i;
+			line += " items in ";
+			line += Power::String::ToString(i * 0.001, Power::NumberFormat::FloatStyle::Fixed, 3);
+			line += 's';
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Log line concatenation average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			Power::String line = Power::Format(POWER_FORMAT("{}: {} items in {:.3f}s"), logName, i, i * 0.001);
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Log line Format average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		report = "";
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			report.ConcatenateFormat(POWER_FORMAT("{}: {} items in {:.3f}s\n"), logName, i, i * 0.001);
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Log line ConcatenateFormat average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		report = "";
+		char lineBuffer[128];
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			snprintf(lineBuffer, sizeof(lineBuffer), "%s: %d items in %.3fs\n", logName.CString(), i, i * 0.001);
+			report.Concatenate(lineBuffer);
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Log line snprintf and Concatenate average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		report = "";
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			report.AppendFormat("%s: %d items in %.3fs\n", logName.CString(), i, i * 0.001);
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+
+		printf("Log line AppendFormat average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
 		string = "MMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMMM";
 		otherString = "ASDF";
 		string.Fill(otherString, 8, 16);
@@ -280,6 +452,14 @@ int main() {
 			deltaTimes[i] = endCount - startCount;
 		}
 		printf("Plus average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
+
+		for (int i = 0; i < measureCount; ++i) {
+			uint64_t startCount = __rdtsc();
+			Power::String powerString = Power::String::Concat(strings[0], strings[1], strings[2], strings[3], strings[4], strings[5], strings[6], strings[7], strings[8], strings[9]);
+			uint64_t endCount = __rdtsc();
+			deltaTimes[i] = endCount - startCount;
+		}
+		printf("Concat average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
 		
 		for (int i = 0; i < measureCount; ++i) {
 			uint64_t startCount = __rdtsc();
@@ -299,6 +479,22 @@ int main() {
 		}
 		printf("Concatenate average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
 
+		{
+			uint64_t startCount = __rdtsc();
+			Power::String powerString;
+			for (int i = 0; i < 1000000; ++i) powerString.Concatenate(strings[i % 10]).Concatenate('\n');
+			uint64_t endCount = __rdtsc();
+			printf("Large Concatenate cycles taken: %lld (size %zd)\n", endCount - startCount, powerString.Size());
+		}
+		{
+			uint64_t startCount = __rdtsc();
+			Power::StringBuilder builder;
+			for (int i = 0; i < 1000000; ++i) builder.Append(strings[i % 10]).Append('\n');
+			Power::String powerString = builder.Build();
+			uint64_t endCount = __rdtsc();
+			printf("Large StringBuilder and Build cycles taken: %lld (size %zd)\n", endCount - startCount, powerString.Size());
+		}
+
 		string = "            arsch             ";
 		printf("String: %s|\n", string.CString());
 		string.TrimEnd();
@@ -339,10 +535,124 @@ int main() {
 		}
 		printf("LastIndexOf for-loop average cycles taken: %lld\n", CalcAverageTSC(deltaTimes, measureCount));
 
+		{
+			uint64_t startCount = __rdtsc();
+			Power::String loaded = Power::String::LoadFileIntoString("test.txt");
+			size_t lineCount = loaded.Lines().Count();
+			uint64_t endCount = __rdtsc();
+			printf("LoadFileIntoString and Lines cycles taken: %lld (%zd lines)\n", endCount - startCount, lineCount);
+		}
+		{
+			uint64_t startCount = __rdtsc();
+			Power::MappedFile mapped("test.txt");
+			size_t lineCount = mapped.Lines().Count();
+			uint64_t endCount = __rdtsc();
+			printf("MappedFile and Lines cycles taken: %lld (%zd lines)\n", endCount - startCount, lineCount);
+		}
+
+		{
+			Power::String loaded(static_cast<size_t>(0));
+			uint64_t startCount = __rdtsc();
+			Power::String::TryLoadFile("test.txt", loaded);
+			uint64_t endCount = __rdtsc();
+			printf("TryLoadFile cycles taken: %lld (%zd bytes)\n", endCount - startCount, loaded.Size());
+		}
+
+		{
+			Power::StreamReader reader(16 * 1024);
+			reader.Open("test.txt");
+			size_t lineCount = 0;
+			uint64_t startCount = __rdtsc();
+			reader.ForEachLine([&lineCount](const Power::StringView&) { ++lineCount; });
+			uint64_t endCount = __rdtsc();
+			printf("StreamReader ForEachLine cycles taken: %lld (%zd lines)\n", endCount - startCount, lineCount);
+		}
+
+		{
+			const char* paths[64];
+			for (int i = 0; i < 64; ++i) paths[i] = "test.txt";
+			Power::String* loaded = new Power::String[64];
+			uint64_t startCount = __rdtsc();
+			for (int i = 0; i < 64; ++i) Power::String::TryLoadFile(paths[i], loaded[i]);
+			uint64_t endCount = __rdtsc();
+			printf("TryLoadFile 64 files one after another cycles taken: %lld\n", endCount - startCount);
+			delete[] loaded;
+
+			loaded = new Power::String[64];
+			startCount = __rdtsc();
+			Power::FileLoader::LoadFiles(paths, 64, loaded);
+			endCount = __rdtsc();
+			printf("FileLoader LoadFiles 64 files cycles taken: %lld\n", endCount - startCount);
+			delete[] loaded;
+
+			loaded = new Power::String[64];
+			startCount = __rdtsc();
+			Power::FileLoader::LoadFiles(paths, 64, loaded, nullptr, 0, Power::File::LoadOptions::Sequential | Power::File::LoadOptions::Threads);
+			endCount = __rdtsc();
+			printf("FileLoader LoadFiles 64 files with threads cycles taken: %lld\n", endCount - startCount);
+			delete[] loaded;
+		}
+
+		{
+			Power::String elements[1000];
+			for (int i = 0; i < 1000; ++i) elements[i] = Power::String::Concat("element number ", i, " with some more text");
+			uint64_t startCount = __rdtsc();
+			FILE* fp = nullptr;
+			if (!fopen_s(&fp, "save benchmark.txt", "wb")) {
+				Power::String joined = Power::String::Join(", ", elements);
+				fwrite(joined.CString(), 1, joined.Size(), fp);
+				fclose(fp);
+			}
+			uint64_t endCount = __rdtsc();
+			printf("Join and fwrite cycles taken: %lld\n", endCount - startCount);
+
+			startCount = __rdtsc();
+			Power::String::SaveJoinedToFile("save benchmark.txt", Power::StringView(", "), elements);
+			endCount = __rdtsc();
+			printf("SaveJoinedToFile cycles taken: %lld\n", endCount - startCount);
+			remove("save benchmark.txt");
+		}
+
+		{
+			Power::String text;
+			for (int i = 0; i < 100000; ++i) text += Power::String::Concat("string number ", i, '\n');
+			text.SaveToFile("table benchmark.txt");
+			Power::StringTable::Write("table benchmark.pst", Power::StringView(text.CString(), text.Size()).Lines());
+
+			uint64_t startCount = __rdtsc();
+			Power::String loaded;
+			Power::String::TryLoadFile("table benchmark.txt", loaded);
+			Power::String* strings = new Power::String[100000];
+			size_t count = 0;
+			for (const Power::StringView& line : Power::StringView(loaded.CString(), loaded.Size()).Lines()) strings[count++] = Power::String(line);
+			uint64_t endCount = __rdtsc();
+			printf("Load and split %zd strings cycles taken: %lld\n", count, endCount - startCount);
+			delete[] strings;
+
+			startCount = __rdtsc();
+			Power::StringTable table;
+			table.Open("table benchmark.pst");
+			size_t size = 0;
+			for (size_t i = 0; i < table.Size(); ++i) size += table[i].Size();
+			endCount = __rdtsc();
+			printf("StringTable Open and read %zd strings cycles taken: %lld\n", table.Size(), endCount - startCount);
+			assert(size + table.Size() == text.Size());
+			table.Close();
+			remove("table benchmark.txt");
+			remove("table benchmark.pst");
+		}
+
 		Power::String fileString = Power::String::LoadFileIntoString("test.txt");
 
 		printf("Size: %zd\n", fileString.Capacity());
 		printf("Count of f: %d\n", fileString.Count('f'));
+		{
+			uint64_t startCount = __rdtsc();
+			bool valid = fileString.IsValidUtf8();
+			uint64_t endCount = __rdtsc();
+			assert(valid);
+			printf("UTF-8 validation cycles taken: %lld\n", endCount - startCount);
+		}
 		{
 			uint64_t startCount = __rdtsc();
 			fileString.ToUpper();
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstring>
+#include <inttypes.h>
+
+
+namespace Power {
+	/// @brief A set of characters stored as a 256-bit bitmap.
+	/// @brief Used wherever a Power::String method accepts a group of characters instead of a single one.
+	/// @brief The bitmap is split into two 16-byte nibble tables, so it can be tested 16 characters at a time with PSHUFB (see Simd::MatchCharSet).
+	///
+	class CharSet {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Whitespace-->
+		/// @brief Creates a Power::CharSet containing the whitespace characters of the C locale: space, \\t, \\n, \\v, \\f and \\r.
+		/// @return A Power::CharSet containing the whitespace characters.
+		///
+		inline static CharSet Whitespace() { return CharSet(" \t\n\v\f\r", 6); }
+
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes an empty Power::CharSet.
+		///
+		CharSet() {
+			memset(low_, 0, sizeof(low_));
+			memset(high_, 0, sizeof(high_));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a Power::CharSet containing all characters of the specified c-string.
+		/// @param[in] chars The c-string with the characters.
+		/// @note <b>If the size of the c-string is already known, it is recommended to use CharSet(const char* const, size_t) instead as it is faster.</b>
+		///
+		explicit CharSet(const char* const chars) : CharSet(chars, strlen(chars)) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a Power::CharSet containing the specified characters.
+		/// @param[in] chars The characters.
+		/// @param[in] size The number of characters.
+		///
+		CharSet(const char* const chars, size_t size) {
+			memset(low_, 0, sizeof(low_));
+			memset(high_, 0, sizeof(high_));
+			for (size_t i = 0; i < size; ++i) this->Add(chars[i]);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Add-->
+		/// @brief Adds the specified character to the Power::CharSet.
+		/// @param[in] c The character to be added.
+		/// @return A reference to the current Power::CharSet.
+		///
+		inline CharSet& Add(const char c) {
+			uint8_t b = static_cast<uint8_t>(c);
+			this->Table(b)[b & 15] |= static_cast<uint8_t>(1 << ((b >> 4) & 7));
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Remove-->
+		/// @brief Removes the specified character from the Power::CharSet.
+		/// @param[in] c The character to be removed.
+		/// @return A reference to the current Power::CharSet.
+		///
+		inline CharSet& Remove(const char c) {
+			uint8_t b = static_cast<uint8_t>(c);
+			this->Table(b)[b & 15] &= static_cast<uint8_t>(~(1 << ((b >> 4) & 7)));
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Contains-->
+		/// @brief Checks if the Power::CharSet contains the specified character.
+		/// @param[in] c The character to be checked for.
+		/// @return <span style="color:#30AA00">True</span>, if the character is part of the Power::CharSet.
+		/// @return <span style="color:#CC3000">False</span>, if it isn't.
+		///
+		inline bool Contains(const char c) const {
+			uint8_t b = static_cast<uint8_t>(c);
+			return ((b < 128 ? low_ : high_)[b & 15] >> ((b >> 4) & 7)) & 1;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsEmpty-->
+		/// @brief Checks if the Power::CharSet is empty.
+		/// @return <span style="color:#30AA00">True</span>, if no character is part of the Power::CharSet.
+		/// @return <span style="color:#CC3000">False</span>, if at least one is.
+		///
+		inline bool IsEmpty() const {
+			uint8_t any = 0;
+			for (size_t i = 0; i < 16; ++i) any |= low_[i] | high_[i];
+			return any == 0;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LowTable-->
+		/// @brief Gets the nibble table of the characters 0-127. Bit (c >> 4) of entry (c & 15) is set, if c is part of the Power::CharSet.
+		/// @return A pointer to 16 bytes.
+		///
+		inline const uint8_t* LowTable() const { return low_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--HighTable-->
+		/// @brief Gets the nibble table of the characters 128-255. Bit ((c >> 4) & 7) of entry (c & 15) is set, if c is part of the Power::CharSet.
+		/// @return A pointer to 16 bytes.
+		///
+		inline const uint8_t* HighTable() const { return high_; }
+
+	private:
+		inline uint8_t* Table(uint8_t b) { return b < 128 ? low_ : high_; }
+
+	private:
+		uint8_t low_[16];
+		uint8_t high_[16];
+	};
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <inttypes.h>
+
+#include "PowerFormat.h"
+
+
+namespace Power {
+	class String;
+
+	/// @brief A lazy concatenation returned by the addition operators of Power::String, e.g. for a + b + c.
+	/// @brief Each node stores a reference to its left side and a copy of one operand, and knows the size of all operands.
+	/// @brief It is materialized with one allocation of the exact size, when it is converted or assigned to a Power::String.
+	/// @note The referenced operands have to outlive the Concatenation, which they do within the expression. Don't store it in an auto variable.
+	///
+	template<typename Left>
+	class Concatenation {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a new Concatenation and measures the operand.
+		/// @param[in] left The Power::String or Concatenation on the left side.
+		/// @param[in] right The operand on the right side.
+		///
+		Concatenation(const Left& left, const Formatting::FormatArgument& right) : left_(left), right_(right), size_(0) {
+			size_ = left_.Size() + right_.MaxLength(Formatting::FormatSpec());
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Addition operator-->
+		/// @brief Appends an operand to the Concatenation.
+		/// @param[in] other A Power::String, c-string, character, integer or floating point value, written like by the addition operators of Power::String.
+		/// @return A Concatenation of this Concatenation and the operand.
+		///
+		template<typename T>
+		inline Concatenation<Concatenation> operator+(const T& other) const { return Concatenation<Concatenation>(*this, Operand(other)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the size of all operands.
+		/// @return The number of characters of the materialized Power::String excluding the null character.
+		///
+		inline size_t Size() const { return size_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+		/// @brief Writes all operands.
+		/// @param[out] destination The buffer receiving Size() characters. No null character is written.
+		/// \n It may be the buffer of the Power::String on the very left.
+		/// @return The position behind the written characters.
+		///
+		inline char* Write(char* destination) const {
+			char* end = WriteLeft(left_, destination);
+			return end + right_.Write(Formatting::FormatSpec(), end);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--References-->
+		/// @brief Checks if an operand on the right of the Power::String on the very left points into a buffer.
+		/// @param[in] data The buffer.
+		/// @param[in] size The number of characters in the buffer.
+		/// @return <span style="color:#30AA00">True</span>, if a string operand points into the buffer, so it can't be written into it.
+		/// @return <span style="color:#CC3000">False</span>, if no string operand points into the buffer.
+		///
+		inline bool References(const char* data, size_t size) const { return right_.PointsInto(data, size) || ReferencesLeft(left_, data, size); }
+
+	private:
+		template<typename T>
+		static inline char* WriteLeft(const T& string, char* destination) {
+			if (string.CString() != destination) memcpy(destination, string.CString(), string.Size());
+			return destination + string.Size();
+		}
+
+		template<typename T>
+		static inline char* WriteLeft(const Concatenation<T>& concatenation, char* destination) { return concatenation.Write(destination); }
+
+		template<typename T>
+		static inline bool ReferencesLeft(const T&, const char*, size_t) { return false; }
+
+		template<typename T>
+		static inline bool ReferencesLeft(const Concatenation<T>& concatenation, const char* data, size_t size) { return concatenation.References(data, size); }
+
+		// The same overloads as the addition operators of Power::String, so e.g. a bool is written as an integer, as it always has been.
+		// Concat and AppendAll write it as "true" or "false" instead.
+		static inline Formatting::FormatArgument Operand(const String& other) { return Formatting::FormatArgument(other); }
+		static inline Formatting::FormatArgument Operand(const char* const other) { return Formatting::FormatArgument(other); }
+		static inline Formatting::FormatArgument Operand(const char c) { return Formatting::FormatArgument(c); }
+		static inline Formatting::FormatArgument Operand(const int16_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const uint16_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const int32_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const uint32_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const int64_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const uint64_t value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const float value) { return Formatting::FormatArgument(value); }
+		static inline Formatting::FormatArgument Operand(const double value) { return Formatting::FormatArgument(value); }
+
+		const Left& left_;
+		Formatting::FormatArgument right_;
+		size_t size_;
+	};
+}
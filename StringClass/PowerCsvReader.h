@@ -0,0 +1,292 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+#include <thread>
+
+#include "PowerSimd.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief The fields of a row read by Power::CsvReader.
+	/// @brief Fields are views into the source. Only quoted fields with escaped quotes ("") are unescaped into a buffer of the row.
+	/// @note Reuse the same row for every CsvReader::ReadRow call, so no memory is allocated once its buffers are large enough.
+	///
+	class CsvRow {
+	public:
+		CsvRow() : fields_(nullptr), size_(0), capacity_(0), escaped_(false), buffer_(nullptr), bufferCapacity_(0) {}
+		CsvRow(const CsvRow&) = delete;
+		CsvRow& operator=(const CsvRow&) = delete;
+
+		~CsvRow() {
+			free(fields_);
+			free(buffer_);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Subscript operator-->
+		/// @brief Gets a field without its enclosing quotes.
+		/// @param i The index of the field.
+		/// @return A Power::StringView of the field. It is valid until the next row is read into this CsvRow.
+		///
+		inline const StringView& operator[](size_t i) const { return fields_[i].view; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the number of fields.
+		/// @return The number of fields of the row.
+		///
+		inline size_t Size() const { return size_; }
+
+	private:
+		friend class CsvReader;
+
+		struct Field {
+			StringView view;
+			bool escaped;			///< The field contains doubled quotes.
+		};
+
+		inline void Clear() {
+			size_ = 0;
+			escaped_ = false;
+		}
+
+		inline void Add(const StringView& view, bool escaped) {
+			if (size_ == capacity_) {
+				capacity_ = capacity_ * 2 + 8;
+				fields_ = static_cast<Field*>(realloc(fields_, capacity_ * sizeof(Field)));
+			}
+			fields_[size_].view = view;
+			fields_[size_].escaped = escaped;
+			escaped_ |= escaped;
+			++size_;
+		}
+
+		// Unescapes the fields with doubled quotes into the buffer, which is grown first, so it isn't moved while the fields are pointed at it.
+		inline void Unescape(const char quote) {
+			size_t size = 0;
+			for (size_t i = 0; i < size_; ++i) {
+				if (fields_[i].escaped) size += fields_[i].view.Size();
+			}
+			if (size > bufferCapacity_) {
+				bufferCapacity_ = size * 2;
+				free(buffer_);
+				buffer_ = static_cast<char*>(malloc(bufferCapacity_));
+			}
+			char* destination = buffer_;
+			for (size_t i = 0; i < size_; ++i) {
+				if (!fields_[i].escaped) continue;
+				const char* data = fields_[i].view.Data();
+				const char* end = data + fields_[i].view.Size();
+				char* begin = destination;
+				// Fields are short, so a byte loop beats calling memchr and memcpy per pair of quotes.
+				for (; data < end; ++data) {
+					*destination++ = *data;
+					if (*data == quote) ++data;
+				}
+				fields_[i].view = StringView(begin, destination - begin);
+			}
+		}
+
+		Field* fields_;
+		size_t size_;
+		size_t capacity_;
+		bool escaped_;			///< Any field contains doubled quotes.
+		char* buffer_;
+		size_t bufferCapacity_;
+	};
+
+	/// @brief Reads the rows of CSV or TSV data (RFC 4180), e.g. loaded with Power::String::LoadFileIntoString.
+	/// @brief The data is scanned 64 bytes at a time: the prefix xor of the quote bitmap marks the bytes inside quotes,
+	/// \n which are removed from the delimiter and newline bitmap. Only the remaining bits are visited.
+	/// @brief Rows end with LF or CRLF. Fields may be quoted and contain delimiters, newlines and doubled quotes.
+	/// @note The data must outlive the reader and the rows read from it.
+	///
+	class CsvReader {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a new Power::CsvReader.
+		/// @param[in] source The data to be read.
+		/// @param[in] delimiter The field delimiter, e.g. ',' or '\t'.
+		/// @param[in] quote The quote character.
+		///
+		explicit CsvReader(const StringView& source, const char delimiter = ',', const char quote = '"') :
+			data_(source.Data()),
+			size_(source.Size()),
+			delimiter_(delimiter),
+			quote_(quote),
+			pclmul_(Simd::GetCpuFeatures().pclmul),
+			position_(0),
+			block_(0),
+			mask_(0),
+			inQuote_(0)
+		{
+			if (size_ > 0) mask_ = this->ScanBlock(0);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ReadRow-->
+		/// @brief Reads the next row.
+		/// @param[out] row The fields of the row.
+		/// @return <span style="color:#30AA00">True</span>, if a row was read.
+		/// @return <span style="color:#CC3000">False</span>, if the end of the data is reached.
+		///
+		inline bool ReadRow(CsvRow& row) {
+			if (position_ >= size_) return false;
+			row.Clear();
+			// The scan state is kept in locals, as the stores of the fields could alias the members.
+			size_t block = block_;
+			uint64_t mask = mask_;
+			size_t begin = position_;
+			while (true) {
+				size_t end = size_;
+				while (mask == 0 && block + 64 < size_) {
+					block += 64;
+					mask = this->ScanBlock(block);
+				}
+				if (mask != 0) {
+					end = block + Simd::CountTrailingZeros64(mask);
+					mask &= mask - 1;
+				}
+				bool rowEnd = end == size_ || data_[end] == '\n';
+				size_t fieldEnd = end;
+				if (rowEnd && fieldEnd > begin && data_[fieldEnd - 1] == '\r') --fieldEnd;
+				this->AddField(row, begin, fieldEnd);
+				begin = end + 1;
+				if (rowEnd) break;
+			}
+			block_ = block;
+			mask_ = mask;
+			position_ = begin < size_ ? begin : size_;
+			if (row.escaped_) row.Unescape(quote_);
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Position-->
+		/// @brief Gets the position of the next row.
+		/// @return The index of the first character of the next row in the data.
+		///
+		inline size_t Position() const { return position_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Partition-->
+		/// @brief Splits CSV data into parts of about the same size, which start and end at row boundaries, so they can be read independently.
+		/// @param[in] source The data to be split.
+		/// @param[in] count The number of parts. At most 64.
+		/// @param[out] parts An array receiving count Power::StringViews. Parts may be empty.
+		/// @param[in] quote The quote character.
+		/// @note The quotes in each part are counted by its own thread. A newline only ends a row, if an even number of quotes precedes it.
+		///
+		static inline void Partition(const StringView& source, size_t count, StringView* parts, const char quote = '"') {
+			if (count > 64) count = 64;
+			size_t quotes[64] = { 0 };
+			std::thread threads[64];
+			for (size_t i = 1; i < count; ++i) {
+				threads[i] = std::thread([&source, &quotes, count, quote, i]() { quotes[i] = CountQuotes(source, count, i, quote); });
+			}
+			if (count > 0) quotes[0] = CountQuotes(source, count, 0, quote);
+			for (size_t i = 1; i < count; ++i) threads[i].join();
+
+			const char* data = source.Data();
+			size_t begin = 0;
+			size_t parity = 0;
+			for (size_t i = 0; i < count; ++i) {
+				parity += quotes[i];
+				size_t end = source.Size();
+				if (i + 1 < count) {
+					// Continues to the first newline outside of quotes, starting with the quote state at the end of the chunk.
+					end = source.Size() / count * (i + 1);
+					bool inQuote = (parity & 1) != 0;
+					while (end < source.Size() && (inQuote || data[end] != '\n')) {
+						if (data[end] == quote) inQuote = !inQuote;
+						++end;
+					}
+					if (end < source.Size()) ++end;
+					if (end < begin) end = begin;
+				}
+				parts[i] = StringView(data + begin, end - begin);
+				begin = end;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParallelForEachRow-->
+		/// @brief Reads all rows with multiple threads, each reading one part of the data (see Partition).
+		/// @param[in] source The data to be read.
+		/// @param[in] function The function called with the index of the part and each CsvRow, e.g. [](size_t part, const Power::CsvRow& row) { ... }.
+		/// \n It is called concurrently for different parts, but in order within a part.
+		/// @param[in] threadCount The number of threads. If 0, one thread per hardware thread is used. At most 64.
+		/// @param[in] delimiter The field delimiter, e.g. ',' or '\t'.
+		/// @param[in] quote The quote character.
+		///
+		template<typename Function>
+		static void ParallelForEachRow(const StringView& source, Function function, size_t threadCount = 0, const char delimiter = ',', const char quote = '"') {
+			if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+			if (threadCount == 0) threadCount = 1;
+			if (threadCount > 64) threadCount = 64;
+			StringView parts[64];
+			Partition(source, threadCount, parts, quote);
+
+			std::thread threads[64];
+			for (size_t i = 1; i < threadCount; ++i) {
+				threads[i] = std::thread([&parts, &function, delimiter, quote, i]() { ReadPart(parts[i], i, function, delimiter, quote); });
+			}
+			ReadPart(parts[0], 0, function, delimiter, quote);
+			for (size_t i = 1; i < threadCount; ++i) threads[i].join();
+		}
+
+	private:
+		template<typename Function>
+		static void ReadPart(const StringView& part, size_t index, Function& function, const char delimiter, const char quote) {
+			CsvReader reader(part, delimiter, quote);
+			CsvRow row;
+			while (reader.ReadRow(row)) function(index, static_cast<const CsvRow&>(row));
+		}
+
+		static inline size_t CountQuotes(const StringView& source, size_t count, size_t index, const char quote) {
+			const char* data = source.Data() + source.Size() / count * index;
+			size_t size = (index + 1 == count ? source.Size() : source.Size() / count * (index + 1)) - source.Size() / count * index;
+			size_t quotes = 0;
+			size_t i = 0;
+			for (; i + 16 <= size; i += 16) quotes += Simd::PopCount(Simd::MatchChar(data + i, quote));
+			for (; i < size; ++i) quotes += data[i] == quote;
+			return quotes;
+		}
+
+		// Gets the delimiters and newlines outside of quotes in the 64 bytes from offset.
+		inline uint64_t ScanBlock(size_t offset) {
+			const char* data = data_ + offset;
+			size_t size = size_ - offset;
+			char padded[64];
+			if (size < 64) {
+				memcpy(padded, data, size);
+				memset(padded + size, 0, 64 - size);
+				data = padded;
+			}
+			uint64_t quotes = Simd::MatchChar64(data, quote_);
+			uint64_t structural = Simd::MatchChar64(data, delimiter_) | Simd::MatchChar64(data, '\n');
+			uint64_t inside = Simd::PrefixXor(quotes, pclmul_) ^ inQuote_;
+			inQuote_ = 0 - (inside >> 63);
+			structural &= ~inside;
+			if (size < 64) structural &= (static_cast<uint64_t>(1) << size) - 1;
+			return structural;
+		}
+
+		inline void AddField(CsvRow& row, size_t begin, size_t end) {
+			const char* field = data_ + begin;
+			size_t size = end - begin;
+			if (size >= 2 && field[0] == quote_ && field[size - 1] == quote_) {
+				bool escaped = memchr(field + 1, quote_, size - 2) != nullptr;
+				row.Add(StringView(field + 1, size - 2), escaped);
+			}
+			else row.Add(StringView(field, size), false);
+		}
+
+		const char* data_;
+		size_t size_;
+		char delimiter_;
+		char quote_;
+		bool pclmul_;
+		size_t position_;
+		size_t block_;			///< The offset of the 64-byte block described by mask_.
+		uint64_t mask_;			///< The delimiters and newlines outside of quotes in block_, which are not visited yet.
+		uint64_t inQuote_;		///< All bits set, if the end of block_ is inside quotes.
+	};
+}
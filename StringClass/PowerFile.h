@@ -0,0 +1,502 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "PowerStringView.h"
+
+
+namespace Power {
+	namespace File {
+		/// @brief The reason a file couldn't be read or written.
+		///
+		enum class FileError {
+			None,			///< The file has been read or written.
+			NotFound,		///< The file or a directory of its path doesn't exist.
+			AccessDenied,	///< The file may not be opened, e.g. because of its permissions.
+			OutOfMemory,	///< The file is larger than the memory which could be allocated.
+			ReadFailed,		///< Opening or reading the file failed for another reason, e.g. because it is a directory.
+			WriteFailed		///< Creating or writing the file failed for another reason, e.g. because the disk is full.
+		};
+
+		/// @brief The result of reading or writing a file.
+		///
+		struct FileResult {
+			size_t size;			///< The number of characters read or written.
+			FileError error;		///< FileError::None, if the whole file has been read or written.
+			int systemError;		///< The errno value or the Windows error code of the failed call. 0, if there is none.
+		};
+
+		/// @brief Options of reading a file. They can be combined with the bitwise or operator.
+		///
+		enum class LoadOptions : uint32_t {
+			None = 0,
+			Sequential = 1,			///< Hints that the file is read from front to back, so the system reads ahead aggressively.
+			DropCache = 2,			///< Hints that the pages of the file aren't needed anymore after it is read, e.g. for files read only once.
+			Threads = 4				///< Makes Power::FileLoader use worker threads with blocking reads, even if io_uring is available.
+		};
+
+		inline LoadOptions operator|(LoadOptions lhs, LoadOptions rhs) { return static_cast<LoadOptions>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)); }
+		inline bool operator&(LoadOptions lhs, LoadOptions rhs) { return (static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)) != 0; }
+
+		/// @brief Options of writing a file. They can be combined with the bitwise or operator.
+		///
+		enum class SaveOptions : uint32_t {
+			None = 0,				///< The file is truncated and written in place.
+			AtomicReplace = 1,		///< A temporary file next to the file is written and renamed to it, so the file either has the old or the whole new content.
+									///< An existing file keeps its permissions and, if the process may change it, its owner (ReplaceFile on Windows).
+			Sync = 2				///< The data is flushed to the disk (fdatasync or FlushFileBuffers) before returning. With AtomicReplace, the rename is flushed too.
+		};
+
+		inline SaveOptions operator|(SaveOptions lhs, SaveOptions rhs) { return static_cast<SaveOptions>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)); }
+		inline bool operator&(SaveOptions lhs, SaveOptions rhs) { return (static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)) != 0; }
+
+#ifdef _WIN32
+		typedef HANDLE NativeFile;
+#else
+		typedef int NativeFile;
+#endif
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MakeResult-->
+		/// @brief Creates the FileResult of a failed system call.
+		/// @param[in] systemError The errno value or the Windows error code.
+		/// @param[in] fallback The FileError, if the code doesn't have a more specific one.
+		/// @return The FileResult with the matching FileError.
+		///
+		inline FileResult MakeResult(int systemError, FileError fallback) {
+			FileResult result = { 0, fallback, systemError };
+#ifdef _WIN32
+			if (systemError == ERROR_FILE_NOT_FOUND || systemError == ERROR_PATH_NOT_FOUND) result.error = FileError::NotFound;
+			else if (systemError == ERROR_ACCESS_DENIED || systemError == ERROR_SHARING_VIOLATION) result.error = FileError::AccessDenied;
+			else if (systemError == ERROR_NOT_ENOUGH_MEMORY || systemError == ERROR_OUTOFMEMORY) result.error = FileError::OutOfMemory;
+#else
+			if (systemError == ENOENT || systemError == ENOTDIR) result.error = FileError::NotFound;
+			else if (systemError == EACCES || systemError == EPERM) result.error = FileError::AccessDenied;
+			else if (systemError == ENOMEM) result.error = FileError::OutOfMemory;
+#endif
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--OpenForReading-->
+		/// @brief Opens a file in binary mode and gets its size.
+		/// @param[in] filePath The path of the file.
+		/// @param[in] options The LoadOptions.
+		/// @param[out] file The opened file. Must be closed with Close(NativeFile, LoadOptions), if no error is returned.
+		/// @param[out] size The size of the file. 0 for files whose size isn't known in advance, e.g. pipes.
+		/// @return The FileResult. Its size is 0.
+		///
+		inline FileResult OpenForReading(const char* const filePath, LoadOptions options, NativeFile& file, uint64_t& size) {
+			FileResult result = { 0, FileError::None, 0 };
+#ifdef _WIN32
+			DWORD flags = FILE_ATTRIBUTE_NORMAL;
+			if (options & LoadOptions::Sequential) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+			file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+			if (file == INVALID_HANDLE_VALUE) return MakeResult(static_cast<int>(GetLastError()), FileError::ReadFailed);
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(file, &fileSize)) fileSize.QuadPart = 0;
+			size = static_cast<uint64_t>(fileSize.QuadPart);
+#else
+			file = open(filePath, O_RDONLY);
+			if (file < 0) return MakeResult(errno, FileError::ReadFailed);
+			struct stat status;
+			size = fstat(file, &status) == 0 && S_ISREG(status.st_mode) ? static_cast<uint64_t>(status.st_size) : 0;
+#if defined(POSIX_FADV_SEQUENTIAL)
+			if (options & LoadOptions::Sequential) posix_fadvise(file, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+#endif
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Read-->
+		/// @brief Reads from a file until the buffer is full or the end of the file is reached, continuing after short reads.
+		/// @param[in] file The file to be read.
+		/// @param[out] data The buffer.
+		/// @param[in] size The size of the buffer.
+		/// @return The FileResult with the number of characters read. They are valid, even if an error is returned.
+		///
+		inline FileResult Read(NativeFile file, char* data, size_t size) {
+			FileResult result = { 0, FileError::None, 0 };
+			while (result.size < size) {
+				size_t count = size - result.size;
+#ifdef _WIN32
+				DWORD read = 0;
+				if (!ReadFile(file, data + result.size, static_cast<DWORD>(count < 0x40000000 ? count : 0x40000000), &read, nullptr)) {
+					FileResult failed = MakeResult(static_cast<int>(GetLastError()), FileError::ReadFailed);
+					failed.size = result.size;
+					return failed;
+				}
+#else
+				ssize_t read = ::read(file, data + result.size, count < 0x40000000 ? count : 0x40000000);
+				if (read < 0) {
+					if (errno == EINTR) continue;
+					FileResult failed = MakeResult(errno, FileError::ReadFailed);
+					failed.size = result.size;
+					return failed;
+				}
+#endif
+				if (read == 0) break;
+				result.size += static_cast<size_t>(read);
+			}
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Rewind-->
+		/// @brief Moves to the start of a file, so it is read again from its first character.
+		/// @param[in] file The file.
+		/// @return The FileResult. Its size is 0.
+		///
+		inline FileResult Rewind(NativeFile file) {
+			FileResult result = { 0, FileError::None, 0 };
+#ifdef _WIN32
+			LARGE_INTEGER start;
+			start.QuadPart = 0;
+			if (!SetFilePointerEx(file, start, nullptr, FILE_BEGIN)) return MakeResult(static_cast<int>(GetLastError()), FileError::ReadFailed);
+#else
+			if (lseek(file, 0, SEEK_SET) < 0) return MakeResult(errno, FileError::ReadFailed);
+#endif
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Close-->
+		/// @brief Closes a file opened with OpenForReading.
+		/// @param[in] file The file to be closed.
+		/// @param[in] options The LoadOptions the file was opened with.
+		///
+		inline void Close(NativeFile file, LoadOptions options) {
+#ifdef _WIN32
+			(void)options;
+			CloseHandle(file);
+#else
+#if defined(POSIX_FADV_DONTNEED)
+			if (options & LoadOptions::DropCache) posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED);
+#else
+			(void)options;
+#endif
+			close(file);
+#endif
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteToDescriptor-->
+		/// @brief Writes characters to a file descriptor, continuing after short writes.
+		/// @param[in] fd The file descriptor.
+		/// @param[in] data The characters to be written.
+		/// @param[in] size The number of characters.
+		/// @return The FileResult with the number of characters written.
+		///
+		inline FileResult WriteToDescriptor(int fd, const char* data, size_t size) {
+			FileResult result = { 0, FileError::None, 0 };
+			while (result.size < size) {
+				size_t count = size - result.size;
+#ifdef _MSC_VER
+				int written = _write(fd, data + result.size, static_cast<unsigned int>(count < 0x40000000 ? count : 0x40000000));
+#else
+				ssize_t written = write(fd, data + result.size, count < 0x40000000 ? count : 0x40000000);
+				if (written < 0 && errno == EINTR) continue;
+#endif
+				if (written <= 0) {
+					FileResult failed = MakeResult(written < 0 ? errno : 0, FileError::WriteFailed);
+					failed.size = result.size;
+					return failed;
+				}
+				result.size += static_cast<size_t>(written);
+			}
+			return result;
+		}
+
+		/// @brief Writes a file in one or more steps and finishes it with Commit().
+		/// @brief With SaveOptions::AtomicReplace, a temporary file is written, which only replaces the file on Commit().
+		/// \n If the Power::File::FileWriter is destroyed without Commit(), e.g. after an error, the temporary file is removed.
+		///
+		class FileWriter {
+		public:
+			FileWriter() : tempPath_(nullptr), path_(nullptr), options_(SaveOptions::None), size_(0), open_(false), partCount_(0), staging_(nullptr), stagingSize_(0) {}
+			FileWriter(const FileWriter&) = delete;
+			FileWriter& operator=(const FileWriter&) = delete;
+
+			~FileWriter() {
+				if (open_) {
+					this->CloseFile();
+					if (tempPath_ != nullptr) remove(tempPath_);
+				}
+				free(tempPath_);
+				free(staging_);
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Open-->
+			/// @brief Creates the file or the temporary file, which replaces it on Commit().
+			/// @param[in] filePath The path of the file. It must be valid until Commit() returns.
+			/// @param[in] options The SaveOptions, e.g. SaveOptions::AtomicReplace | SaveOptions::Sync.
+			/// @return The FileResult. Its size is 0.
+			///
+			inline FileResult Open(const char* const filePath, SaveOptions options) {
+				static std::atomic<uint32_t> s_tempCounter(0);
+				FileResult result = { 0, FileError::None, 0 };
+				if (open_) {
+					this->CloseFile();
+					if (tempPath_ != nullptr) remove(tempPath_);
+				}
+				free(tempPath_);
+				tempPath_ = nullptr;
+				path_ = filePath;
+				options_ = options;
+				size_ = 0;
+				partCount_ = 0;
+				stagingSize_ = 0;
+				const char* target = filePath;
+				if (options & SaveOptions::AtomicReplace) {
+					size_t size = strlen(filePath) + 32;
+					tempPath_ = static_cast<char*>(malloc(size));
+#ifdef _WIN32
+					unsigned long process = GetCurrentProcessId();
+#else
+					unsigned long process = static_cast<unsigned long>(getpid());
+#endif
+					snprintf(tempPath_, size, "%s.%lu.%u.tmp", filePath, process, static_cast<unsigned int>(s_tempCounter++));
+					target = tempPath_;
+				}
+#ifdef _WIN32
+				file_ = CreateFileA(target, GENERIC_WRITE, 0, nullptr, tempPath_ != nullptr ? CREATE_NEW : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if (file_ == INVALID_HANDLE_VALUE) return MakeResult(static_cast<int>(GetLastError()), FileError::WriteFailed);
+#else
+				file_ = open(target, O_WRONLY | O_CREAT | (tempPath_ != nullptr ? O_EXCL : O_TRUNC), 0666);
+				if (file_ < 0) return MakeResult(errno, FileError::WriteFailed);
+				// The temporary file is created with the default mode, so it takes over the mode and owner of the file it replaces.
+				struct stat status;
+				if (tempPath_ != nullptr && stat(filePath, &status) == 0) {
+					fchmod(file_, status.st_mode & 07777);
+					if (fchown(file_, status.st_uid, status.st_gid) != 0) fchmod(file_, status.st_mode & 0777);
+				}
+#endif
+				open_ = true;
+				return result;
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+			/// @brief Writes characters behind the characters written before, continuing after short writes.
+			/// @param[in] data The characters to be written.
+			/// @param[in] size The number of characters.
+			/// @return The FileResult with the number of characters written by this call.
+			///
+			inline FileResult Write(const char* data, size_t size) {
+				FileResult result = { 0, FileError::None, 0 };
+				while (result.size < size) {
+					size_t count = size - result.size;
+#ifdef _WIN32
+					DWORD written = 0;
+					if (!WriteFile(file_, data + result.size, static_cast<DWORD>(count < 0x40000000 ? count : 0x40000000), &written, nullptr)) {
+						size_ += result.size;
+						return this->Failed(static_cast<int>(GetLastError()), result);
+					}
+#else
+					ssize_t written = write(file_, data + result.size, count < 0x40000000 ? count : 0x40000000);
+					if (written < 0) {
+						if (errno == EINTR) continue;
+						size_ += result.size;
+						return this->Failed(errno, result);
+					}
+#endif
+					result.size += static_cast<size_t>(written);
+				}
+				size_ += result.size;
+				return result;
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Writes a batch of Power::StringViews one after another, with one writev call per 64 of them on POSIX.
+			/// @param[in] parts The Power::StringViews to be written.
+			/// @param[in] count The number of Power::StringViews.
+			/// @return The FileResult with the number of characters written by this call.
+			///
+			inline FileResult Write(const StringView* parts, size_t count) {
+				FileResult result = { 0, FileError::None, 0 };
+#ifdef _WIN32
+				for (size_t i = 0; i < count; ++i) {
+					FileResult part = this->Write(parts[i].Data(), parts[i].Size());
+					result.size += part.size;
+					if (part.error != FileError::None) {
+						part.size = result.size;
+						return part;
+					}
+				}
+#else
+				struct iovec vectors[64];
+				size_t i = 0;
+				while (i < count) {
+					size_t vectorCount = 0;
+					for (; i < count && vectorCount < 64; ++i) {
+						if (parts[i].IsEmpty()) continue;
+						vectors[vectorCount].iov_base = const_cast<char*>(parts[i].Data());
+						vectors[vectorCount].iov_len = parts[i].Size();
+						++vectorCount;
+					}
+					// A short write continues with the rest of the first vector which wasn't written completely.
+					size_t first = 0;
+					while (first < vectorCount) {
+						ssize_t written = writev(file_, vectors + first, static_cast<int>(vectorCount - first));
+						if (written < 0) {
+							if (errno == EINTR) continue;
+							return this->Failed(errno, result);
+						}
+						result.size += static_cast<size_t>(written);
+						size_ += static_cast<size_t>(written);
+						size_t rest = static_cast<size_t>(written);
+						while (first < vectorCount && rest >= vectors[first].iov_len) rest -= vectors[first++].iov_len;
+						if (first < vectorCount) {
+							vectors[first].iov_base = static_cast<char*>(vectors[first].iov_base) + rest;
+							vectors[first].iov_len -= rest;
+						}
+					}
+				}
+#endif
+				return result;
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Append-->
+			/// @brief Queues characters to be written behind the characters appended before. The queue is written, when it is full or on Commit().
+			/// @param[in] data The characters to be written. If they are 4KB or larger, they are written from where they are and must be valid until then.
+			/// @param[in] size The number of characters.
+			/// @return The FileResult of writing the queue, if it was full. Otherwise its size is 0.
+			/// @note Smaller pieces are copied into a buffer of 64KB, so many small pieces don't cost a system call each. 
+			///
+			inline FileResult Append(const char* data, size_t size) {
+				FileResult result = { 0, FileError::None, 0 };
+				if (size == 0) return result;
+				bool small = size < s_stagingCapacity / 16;
+				if (partCount_ == 64 || (small && stagingSize_ + size > s_stagingCapacity)) {
+					result = this->Flush();
+					if (result.error != FileError::None) return result;
+				}
+				if (!small) {
+					parts_[partCount_++] = StringView(data, size);
+					return result;
+				}
+				if (staging_ == nullptr) staging_ = static_cast<char*>(malloc(s_stagingCapacity));
+				char* destination = staging_ + stagingSize_;
+				memcpy(destination, data, size);
+				stagingSize_ += size;
+				// Consecutive small pieces are merged into one part.
+				if (partCount_ > 0 && parts_[partCount_ - 1].Data() + parts_[partCount_ - 1].Size() == destination) {
+					parts_[partCount_ - 1] = StringView(parts_[partCount_ - 1].Data(), parts_[partCount_ - 1].Size() + size);
+				}
+				else parts_[partCount_++] = StringView(destination, size);
+				return result;
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Commit-->
+			/// @brief Finishes the file: flushes it with SaveOptions::Sync, closes it and renames the temporary file with SaveOptions::AtomicReplace.
+			/// @return The FileResult with the number of characters written to the file. If an error is returned, the temporary file is removed.
+			///
+			inline FileResult Commit() {
+				FileResult result = { size_, FileError::None, 0 };
+				if (!open_) return MakeResult(0, FileError::WriteFailed);
+				result = this->Flush();
+				if (result.error != FileError::None) return result;
+				open_ = false;
+#ifdef _WIN32
+				if ((options_ & SaveOptions::Sync) && !FlushFileBuffers(file_)) result = MakeResult(static_cast<int>(GetLastError()), FileError::WriteFailed);
+				CloseHandle(file_);
+				if (tempPath_ != nullptr && result.error == FileError::None) {
+					// ReplaceFile keeps the attributes and the security descriptor of an existing file. A new file is moved into place.
+					if (!ReplaceFileA(path_, tempPath_, nullptr, REPLACEFILE_IGNORE_MERGE_ERRORS, nullptr, nullptr)) {
+						DWORD flags = MOVEFILE_REPLACE_EXISTING;
+						if (options_ & SaveOptions::Sync) flags |= MOVEFILE_WRITE_THROUGH;
+						if (GetLastError() != ERROR_FILE_NOT_FOUND || !MoveFileExA(tempPath_, path_, flags)) result = MakeResult(static_cast<int>(GetLastError()), FileError::WriteFailed);
+					}
+				}
+#else
+				if (options_ & SaveOptions::Sync) {
+#if defined(__APPLE__)
+					if (fsync(file_) != 0) result = MakeResult(errno, FileError::WriteFailed);
+#else
+					if (fdatasync(file_) != 0) result = MakeResult(errno, FileError::WriteFailed);
+#endif
+				}
+				// Some file systems, e.g. NFS, only report write errors on close.
+				if (close(file_) != 0 && result.error == FileError::None) result = MakeResult(errno, FileError::WriteFailed);
+				if (tempPath_ != nullptr && result.error == FileError::None) {
+					if (rename(tempPath_, path_) != 0) result = MakeResult(errno, FileError::WriteFailed);
+					else if (options_ & SaveOptions::Sync) this->SyncDirectory();
+				}
+#endif
+				if (tempPath_ != nullptr && result.error != FileError::None) remove(tempPath_);
+				result.size = size_;
+				return result;
+			}
+
+		private:
+			static const size_t s_stagingCapacity = 64 * 1024;
+
+			inline FileResult Flush() {
+				FileResult result = this->Write(parts_, partCount_);
+				partCount_ = 0;
+				stagingSize_ = 0;
+				return result;
+			}
+
+			// Only reports the error. The characters written before it have already been added to the size of the file.
+			inline FileResult Failed(int systemError, const FileResult& written) {
+				FileResult result = MakeResult(systemError, FileError::WriteFailed);
+				result.size = written.size;
+				return result;
+			}
+
+			inline void CloseFile() {
+#ifdef _WIN32
+				CloseHandle(file_);
+#else
+				close(file_);
+#endif
+				open_ = false;
+			}
+
+#ifndef _WIN32
+			// Flushes the directory of the file, so the rename survives a crash. The temporary path is reused for the path of the directory.
+			inline void SyncDirectory() {
+				const char* slash = strrchr(path_, '/');
+				if (slash == nullptr) strcpy(tempPath_, ".");
+				else if (slash == path_) strcpy(tempPath_, "/");
+				else {
+					memcpy(tempPath_, path_, slash - path_);
+					tempPath_[slash - path_] = '\0';
+				}
+				int directory = open(tempPath_, O_RDONLY);
+				if (directory < 0) return;
+				fsync(directory);
+				close(directory);
+			}
+#endif
+
+			NativeFile file_;
+			char* tempPath_;			///< The path of the temporary file with SaveOptions::AtomicReplace or nullptr.
+			const char* path_;
+			SaveOptions options_;
+			size_t size_;				///< The number of characters written so far.
+			bool open_;
+			StringView parts_[64];		///< The queue of Append().
+			size_t partCount_;
+			char* staging_;				///< The copies of the small pieces in the queue.
+			size_t stagingSize_;
+		};
+	}
+}
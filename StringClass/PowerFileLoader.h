@@ -0,0 +1,350 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <inttypes.h>
+#include <thread>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "PowerFile.h"
+#include "PowerString.h"
+
+
+namespace Power {
+	/// @brief Loads many files concurrently, so the latency of one read overlaps with the others instead of adding up.
+	/// @brief On Linux, the reads are submitted through io_uring from the calling thread. Each file is opened, measured with fstat and read
+	/// \n into a buffer of its size, with a bounded number of reads in flight. If io_uring isn't available (or File::LoadOptions::Threads is set),
+	/// \n worker threads take the next file and read it with Power::String::TryLoadFile instead. The number of reads in flight is the number of threads.
+	///
+	class FileLoader {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ForEachFile-->
+		/// @brief Loads files and passes each one to a function, as soon as it is loaded.
+		/// @param[in] paths An array of file paths, either c-strings or Power::Strings.
+		/// @param[in] count The number of paths.
+		/// @param[in] function The function called with the index of the path, the file data and the File::FileResult,
+		/// \n e.g. [](size_t index, const Power::String& data, const Power::File::FileResult& result) { ... }. The data is only valid until the function returns.
+		/// \n With io_uring, it is called from the calling thread. Otherwise it is called concurrently from the worker threads.
+		/// @param[in] threadCount The number of worker threads, or the number of reads in flight with io_uring.
+		/// \n If 0, one thread per hardware thread, or 64 reads with io_uring, are used. At most 64.
+		/// @param[in] options The File::LoadOptions.
+		/// @note Each thread or read reuses one Power::String for all of its files, so memory use is bounded by their number times the largest file.
+		/// @note <span style="color:#FF0000"><b>Warning</b></span>: The instance counters of Power::String aren't atomic, so the function must not construct,
+		/// \n copy or destroy Power::Strings, when it is called from the worker threads. Copy the data into other storage or use LoadFiles instead.
+		///
+		template<typename Path, typename Function>
+		static void ForEachFile(const Path* paths, size_t count, Function function, size_t threadCount = 0, File::LoadOptions options = File::LoadOptions::Sequential) {
+			// The buffers are created on the calling thread, as the instance counters of Power::String aren't atomic.
+			String buffers[64];
+#ifdef __linux__
+			if (!(options & File::LoadOptions::Threads)) {
+				auto acquire = [&buffers](size_t, size_t slot) -> String& { return buffers[slot]; };
+				auto complete = [&function](size_t index, String& data, const File::FileResult& result) {
+					if (result.error != File::FileError::None && result.size == 0) data = "";
+					function(index, static_cast<const String&>(data), result);
+				};
+				if (RunRing(paths, count, RingDepth(threadCount), options, acquire, complete)) return;
+			}
+#endif
+			threadCount = ThreadCount(count, threadCount);
+			std::atomic<size_t> next(0);
+			auto work = [paths, count, &function, &next, &buffers, options](size_t thread) {
+				String& data = buffers[thread];
+				for (size_t i = next++; i < count; i = next++) {
+					File::FileResult result = String::TryLoadFile(paths[i], data, options);
+					if (result.error != File::FileError::None && result.size == 0) data = "";
+					function(i, static_cast<const String&>(data), static_cast<const File::FileResult&>(result));
+				}
+			};
+			Run(work, threadCount);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LoadFiles-->
+		/// @brief Loads files into an array of Power::Strings.
+		/// @param[in] paths An array of file paths, either c-strings or Power::Strings.
+		/// @param[in] count The number of paths.
+		/// @param[out] destinations An array of count Power::Strings receiving the file data. A Power::String is left unchanged, if its file can't be opened.
+		/// @param[out] results An array of count File::FileResults or nullptr, if they aren't needed.
+		/// @param[in] threadCount The number of worker threads, or the number of reads in flight with io_uring.
+		/// \n If 0, one thread per hardware thread, or 64 reads with io_uring, are used. At most 64.
+		/// @param[in] options The File::LoadOptions.
+		/// @return <span style="color:#30AA00">True</span>, if all files were loaded.
+		/// @return <span style="color:#CC3000">False</span>, if any file couldn't be loaded.
+		///
+		template<typename Path>
+		static bool LoadFiles(const Path* paths, size_t count, String* destinations, File::FileResult* results = nullptr, size_t threadCount = 0, File::LoadOptions options = File::LoadOptions::Sequential) {
+#ifdef __linux__
+			if (!(options & File::LoadOptions::Threads)) {
+				bool loaded = true;
+				auto acquire = [destinations](size_t index, size_t) -> String& { return destinations[index]; };
+				auto complete = [results, &loaded](size_t index, String&, const File::FileResult& result) {
+					if (result.error != File::FileError::None) loaded = false;
+					if (results != nullptr) results[index] = result;
+				};
+				if (RunRing(paths, count, RingDepth(threadCount), options, acquire, complete)) return loaded;
+			}
+#endif
+			std::atomic<size_t> next(0);
+			std::atomic<bool> loaded(true);
+			auto work = [paths, count, destinations, results, &next, &loaded, options](size_t) {
+				for (size_t i = next++; i < count; i = next++) {
+					File::FileResult result = String::TryLoadFile(paths[i], destinations[i], options);
+					if (result.error != File::FileError::None) loaded = false;
+					if (results != nullptr) results[i] = result;
+				}
+			};
+			Run(work, ThreadCount(count, threadCount));
+			return loaded;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LoadFilesAsync-->
+		/// @brief Starts loading files into an array of Power::Strings in the background, like LoadFiles, and returns immediately.
+		/// @param[in] paths An array of file paths, either c-strings or Power::Strings.
+		/// @param[in] count The number of paths.
+		/// @param[out] destinations An array of count Power::Strings receiving the file data. A Power::String is left unchanged, if its file can't be opened.
+		/// @param[out] results An array of count File::FileResults or nullptr, if they aren't needed.
+		/// @param[in] threadCount The number of worker threads, or the number of reads in flight with io_uring.
+		/// \n If 0, one thread per hardware thread, or 64 reads with io_uring, are used. At most 64.
+		/// @param[in] options The File::LoadOptions.
+		/// @return A std::future, which becomes ready with the result of LoadFiles, when all files are loaded.
+		/// @note <b>The arrays must stay valid and must not be accessed until the future is ready.</b> No Power::Strings are constructed while loading.
+		///
+		template<typename Path>
+		static std::future<bool> LoadFilesAsync(const Path* paths, size_t count, String* destinations, File::FileResult* results = nullptr, size_t threadCount = 0, File::LoadOptions options = File::LoadOptions::Sequential) {
+			return std::async(std::launch::async, [paths, count, destinations, results, threadCount, options]() { return LoadFiles(paths, count, destinations, results, threadCount, options); });
+		}
+
+	private:
+		static inline size_t ThreadCount(size_t count, size_t threadCount) {
+			if (threadCount == 0) threadCount = std::thread::hardware_concurrency();
+			if (threadCount > count) threadCount = count;
+			if (threadCount > 64) threadCount = 64;
+			return threadCount > 0 ? threadCount : 1;
+		}
+
+		// Runs the work on the calling thread and threadCount - 1 more threads, passing the index of the thread.
+		template<typename Work>
+		static void Run(Work& work, size_t threadCount) {
+			std::thread threads[64];
+			for (size_t i = 1; i < threadCount; ++i) threads[i] = std::thread(std::ref(work), i);
+			work(0);
+			for (size_t i = 1; i < threadCount; ++i) threads[i].join();
+		}
+
+#ifdef __linux__
+		static inline size_t RingDepth(size_t depth) { return depth == 0 || depth > 64 ? 64 : depth; }
+
+		static inline const char* PathOf(const String& path) { return path.CString(); }
+		static inline const char* PathOf(const char* const path) { return path; }
+
+		// A minimal io_uring set up with the raw system calls, so liburing isn't needed. Each slot has at most one read in flight.
+		class Ring {
+		public:
+			Ring() : fd_(-1), sqRing_(MAP_FAILED), cqRing_(MAP_FAILED), sqes_(MAP_FAILED), sqRingSize_(0), cqRingSize_(0), sqesSize_(0) {}
+
+			Ring(const Ring&) = delete;
+			Ring& operator=(const Ring&) = delete;
+
+			~Ring() {
+				if (sqes_ != MAP_FAILED) munmap(sqes_, sqesSize_);
+				if (cqRing_ != MAP_FAILED && cqRing_ != sqRing_) munmap(cqRing_, cqRingSize_);
+				if (sqRing_ != MAP_FAILED) munmap(sqRing_, sqRingSize_);
+				if (fd_ >= 0) close(fd_);
+			}
+
+			// Fails on kernels without io_uring or if it is disabled, e.g. by a seccomp filter.
+			inline bool Setup(unsigned entries) {
+				io_uring_params params;
+				memset(&params, 0, sizeof(params));
+				fd_ = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+				if (fd_ < 0) return false;
+				sqRingSize_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+				cqRingSize_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+				const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+				if (singleMap) sqRingSize_ = cqRingSize_ = sqRingSize_ > cqRingSize_ ? sqRingSize_ : cqRingSize_;
+				sqRing_ = mmap(nullptr, sqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING);
+				if (sqRing_ == MAP_FAILED) return false;
+				cqRing_ = singleMap ? sqRing_ : mmap(nullptr, cqRingSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING);
+				if (cqRing_ == MAP_FAILED) return false;
+				sqesSize_ = params.sq_entries * sizeof(io_uring_sqe);
+				sqes_ = mmap(nullptr, sqesSize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES);
+				if (sqes_ == MAP_FAILED) return false;
+				char* sq = static_cast<char*>(sqRing_);
+				char* cq = static_cast<char*>(cqRing_);
+				sqHead_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+				sqTail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+				sqMask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+				sqArray_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+				cqHead_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+				cqTail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+				cqMask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+				cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+				return true;
+			}
+
+			// Queues a read at the offset of the file, at most 1GB, tagged with the slot. IORING_OP_READV is used, as it is supported since Linux 5.1.
+			inline void Read(int file, char* data, size_t size, uint64_t offset, size_t slot) {
+				vectors_[slot].iov_base = data;
+				vectors_[slot].iov_len = size < 0x40000000 ? size : 0x40000000;
+				unsigned tail = *sqTail_;
+				unsigned index = tail & sqMask_;
+				io_uring_sqe* entry = static_cast<io_uring_sqe*>(sqes_) + index;
+				memset(entry, 0, sizeof(io_uring_sqe));
+				entry->opcode = IORING_OP_READV;
+				entry->fd = file;
+				entry->addr = reinterpret_cast<uint64_t>(&vectors_[slot]);
+				entry->len = 1;
+				entry->off = offset;
+				entry->user_data = slot;
+				sqArray_[index] = index;
+				__atomic_store_n(sqTail_, tail + 1, __ATOMIC_RELEASE);
+			}
+
+			// Submits the queued reads and waits for at least one completion.
+			inline bool SubmitAndWait() {
+				while (true) {
+					unsigned queued = *sqTail_ - __atomic_load_n(sqHead_, __ATOMIC_ACQUIRE);
+					if (syscall(__NR_io_uring_enter, fd_, queued, 1, IORING_ENTER_GETEVENTS, nullptr, 0) >= 0) return true;
+					if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return false;
+				}
+			}
+
+			// Passes the slot and the result of each completed read to the function.
+			template<typename Function>
+			inline void ForEachCompletion(Function function) {
+				unsigned head = *cqHead_;
+				unsigned tail = __atomic_load_n(cqTail_, __ATOMIC_ACQUIRE);
+				for (; head != tail; ++head) {
+					const io_uring_cqe& completion = cqes_[head & cqMask_];
+					function(static_cast<size_t>(completion.user_data), completion.res);
+				}
+				__atomic_store_n(cqHead_, head, __ATOMIC_RELEASE);
+			}
+
+		private:
+			int fd_;
+			void* sqRing_;
+			void* cqRing_;
+			void* sqes_;
+			size_t sqRingSize_;
+			size_t cqRingSize_;
+			size_t sqesSize_;
+			unsigned* sqHead_;
+			unsigned* sqTail_;
+			unsigned sqMask_;
+			unsigned* sqArray_;
+			unsigned* cqHead_;
+			unsigned* cqTail_;
+			unsigned cqMask_;
+			io_uring_cqe* cqes_;
+			struct iovec vectors_[64];
+		};
+
+		// Loads the files with up to depth reads in flight through io_uring on the calling thread.
+		// acquire(index, slot) returns the Power::String the file is read into, complete(index, data, result) is called when it is loaded.
+		// Returns false before loading anything, if io_uring isn't available.
+		template<typename Path, typename Acquire, typename Complete>
+		static bool RunRing(const Path* paths, size_t count, size_t depth, File::LoadOptions options, Acquire& acquire, Complete& complete) {
+			Ring ring;
+			if (!ring.Setup(static_cast<unsigned>(depth))) return false;
+			struct Slot {
+				size_t index;
+				int file;
+				String* data;
+				size_t size;
+				size_t done;
+				bool active;
+			};
+			Slot slots[64];
+			size_t freeSlots[64];
+			for (size_t i = 0; i < depth; ++i) {
+				slots[i].active = false;
+				freeSlots[i] = depth - 1 - i;
+			}
+			size_t freeCount = depth;
+			size_t next = 0;
+			auto finish = [&slots, &freeSlots, &freeCount, &complete, options](size_t slot, const File::FileResult& result) {
+				File::Close(slots[slot].file, options);
+				slots[slot].data->SetNewSize(result.size);
+				slots[slot].active = false;
+				freeSlots[freeCount++] = slot;
+				complete(slots[slot].index, *slots[slot].data, result);
+			};
+
+			while (next < count || freeCount < depth) {
+				while (next < count && freeCount > 0) {
+					const size_t index = next++;
+					const size_t slot = freeSlots[freeCount - 1];
+					String& data = acquire(index, slot);
+					File::NativeFile file;
+					uint64_t fileSize = 0;
+					File::FileResult result = File::OpenForReading(PathOf(paths[index]), options, file, fileSize);
+					if (result.error == File::FileError::None && (fileSize == 0 || fileSize >= SIZE_MAX / 4)) {
+						// Files of unknown size, e.g. in /proc, are read until their end with blocking reads.
+						File::Close(file, options);
+						result = String::TryLoadFile(paths[index], data, options);
+					}
+					else if (result.error == File::FileError::None) {
+						--freeCount;
+						const size_t size = static_cast<size_t>(fileSize);
+						if (size >= data.capacity_) data.Reallocate(size + 1);
+						slots[slot] = { index, file, &data, size, 0, true };
+						ring.Read(file, data.data_, size, 0, slot);
+						continue;
+					}
+					complete(index, data, static_cast<const File::FileResult&>(result));
+				}
+				if (freeCount == depth) continue;
+
+				if (!ring.SubmitAndWait()) {
+					// io_uring_enter only fails before submitting anything, so the reads which haven't completed are finished with blocking reads.
+					for (size_t slot = 0; slot < depth; ++slot) {
+						if (!slots[slot].active) continue;
+						Slot& current = slots[slot];
+						File::FileResult result = MakeResultOf(lseek(current.file, static_cast<off_t>(current.done), SEEK_SET) < 0 ? errno : 0, current.done);
+						if (result.error == File::FileError::None) {
+							result = File::Read(current.file, current.data->data_ + current.done, current.size - current.done);
+							result.size += current.done;
+						}
+						finish(slot, result);
+					}
+					continue;
+				}
+				ring.ForEachCompletion([&slots, &ring, &finish](size_t slot, int32_t read) {
+					Slot& current = slots[slot];
+					if (read == -EINTR || read == -EAGAIN) {
+						ring.Read(current.file, current.data->data_ + current.done, current.size - current.done, current.done, slot);
+						return;
+					}
+					if (read > 0) current.done += static_cast<size_t>(read);
+					// A short read continues behind the read characters, a read of 0 characters means the file has become shorter.
+					if (read > 0 && current.done < current.size) {
+						ring.Read(current.file, current.data->data_ + current.done, current.size - current.done, current.done, slot);
+						return;
+					}
+					finish(slot, MakeResultOf(read < 0 ? -read : 0, current.done));
+				});
+			}
+			return true;
+		}
+
+		static inline File::FileResult MakeResultOf(int systemError, size_t size) {
+			File::FileResult result = { size, File::FileError::None, 0 };
+			if (systemError == 0) return result;
+			result = File::MakeResult(systemError, File::FileError::ReadFailed);
+			result.size = size;
+			return result;
+		}
+#endif
+	};
+}
@@ -0,0 +1,454 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <inttypes.h>
+#include <type_traits>
+#include <utility>
+
+#include "PowerNumberFormat.h"
+#include "PowerSimd.h"
+#include "PowerStringView.h"
+
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--POWER_FORMAT-->
+/// @brief Wraps a string literal into a format string for Power::Format, which is parsed and validated at compile time.
+/// @param[in] literal The format string literal. Fields are "{}" or "{:[.precision][type]}" with the type f, e, g, x or X. "{{" and "}}" are written as '{' and '}'.
+/// @note The literal is returned by a static constexpr member function of a local type, because function parameters can't be used in constant expressions.
+///
+#define POWER_FORMAT(literal) [] { struct FormatString : Power::Formatting::FormatStringBase { static constexpr const char* Get() { return literal; } }; return FormatString(); }()
+
+
+namespace Power {
+	class String;
+
+	namespace Formatting {
+		/// @brief The base of the types created by POWER_FORMAT.
+		///
+		struct FormatStringBase {};
+
+		/// @brief The options of a field of a format string.
+		///
+		struct FormatSpec {
+			constexpr FormatSpec() : type('\0'), precision(-1) {}
+			constexpr FormatSpec(char type, int32_t precision) : type(type), precision(precision) {}
+
+			char type;				///< 'f', 'e' or 'g' for the notation of floating point values, 'x' or 'X' for hexadecimal integers, '\0' for the default.
+			int32_t precision;		///< The digits of floating point values, or the maximum number of characters of strings. -1, if not specified.
+		};
+
+		// The compile time parser. C++11 constexpr functions consist of a single return statement, so the format string is walked recursively,
+		// one character or field per call. The recursion depth limit of the compiler (512 by default) limits the length of a format string.
+
+		constexpr bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+		constexpr bool IsType(char c) { return c == 'f' || c == 'e' || c == 'g' || c == 'x' || c == 'X'; }
+		constexpr const char* SkipDigits(const char* f) { return IsDigit(*f) ? SkipDigits(f + 1) : f; }
+		constexpr int32_t ParseNumber(const char* f, int32_t value) { return IsDigit(*f) ? ParseNumber(f + 1, value * 10 + (*f - '0')) : value; }
+		constexpr const char* SkipPrecision(const char* f) { return *f != '.' ? f : IsDigit(f[1]) ? SkipDigits(f + 1) : nullptr; }
+		constexpr const char* SkipType(const char* f) { return f == nullptr ? nullptr : IsType(*f) ? f + 1 : f; }
+		constexpr const char* SkipClose(const char* f) { return f != nullptr && *f == '}' ? f + 1 : nullptr; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SkipField-->
+		/// @brief Skips the options and the closing brace of a field.
+		/// @param[in] f The position behind the opening brace.
+		/// @return The position behind the closing brace, or nullptr, if the field is invalid.
+		///
+		constexpr const char* SkipField(const char* f) { return *f == '}' ? f + 1 : *f == ':' ? SkipClose(SkipType(SkipPrecision(f + 1))) : nullptr; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountFields-->
+		/// @brief Validates a format string and counts its fields.
+		/// @param[in] f The format string.
+		/// @param[in] count The number of fields in front of f.
+		/// @return The number of fields, or -1, if a field is invalid or a brace is not escaped.
+		///
+		constexpr int32_t CountFields(const char* f, int32_t count = 0) {
+			return f == nullptr ? -1
+				: *f == '\0' ? count
+				: *f == '{' ? (f[1] == '{' ? CountFields(f + 2, count) : CountFields(SkipField(f + 1), count + 1))
+				: *f == '}' ? (f[1] == '}' ? CountFields(f + 2, count) : -1)
+				: CountFields(f + 1, count);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LiteralLength-->
+		/// @brief Counts the characters of a valid format string which are written as they are.
+		/// @param[in] f The format string.
+		/// @param[in] length The number of characters in front of f.
+		/// @return The number of characters outside of the fields. Escaped braces count once.
+		///
+		constexpr size_t LiteralLength(const char* f, size_t length = 0) {
+			return f == nullptr || *f == '\0' ? length
+				: (*f == '{' || *f == '}') && f[1] == *f ? LiteralLength(f + 2, length + 1)
+				: *f == '{' ? LiteralLength(SkipField(f + 1), length)
+				: LiteralLength(f + 1, length + 1);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FieldSpec-->
+		/// @brief Parses the options of a field of a valid format string.
+		/// @param[in] f The format string.
+		/// @param[in] index The index of the field.
+		/// @return The options of the field.
+		///
+		constexpr FormatSpec FieldSpec(const char* f, size_t index) {
+			return f == nullptr || *f == '\0' ? FormatSpec()
+				: (*f == '{' || *f == '}') && f[1] == *f ? FieldSpec(f + 2, index)
+				: *f != '{' ? FieldSpec(f + 1, index)
+				: index != 0 ? FieldSpec(SkipField(f + 1), index - 1)
+				: f[1] != ':' ? FormatSpec()
+				: f[2] == '.' ? FormatSpec(IsType(*SkipDigits(f + 3)) ? *SkipDigits(f + 3) : '\0', ParseNumber(f + 3, 0))
+				: FormatSpec(IsType(f[2]) ? f[2] : '\0', -1);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FieldOffset-->
+		/// @brief Finds a field of a valid format string.
+		/// @param[in] f The format string.
+		/// @param[in] index The index of the field.
+		/// @param[in] offset The offset to start at.
+		/// @return The offset of the opening brace of the field, or the size of the format string, if there are index fields or less.
+		///
+		constexpr size_t FieldOffset(const char* f, size_t index, size_t offset = 0) {
+			return f[offset] == '\0' ? offset
+				: (f[offset] == '{' || f[offset] == '}') && f[offset + 1] == f[offset] ? FieldOffset(f, index, offset + 2)
+				: f[offset] != '{' ? FieldOffset(f, index, offset + 1)
+				: index == 0 ? offset
+				: FieldOffset(f, index - 1, static_cast<size_t>(SkipField(f + offset + 1) - f));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LiteralBegin-->
+		/// @brief Finds the literal part in front of a field of a valid format string.
+		/// @param[in] f The format string.
+		/// @param[in] index The index of the field, or the number of fields for the literal part behind the last field.
+		/// @return The offset behind the closing brace of the previous field.
+		///
+		constexpr size_t LiteralBegin(const char* f, size_t index) {
+			return index == 0 ? 0 : static_cast<size_t>(SkipField(f + FieldOffset(f, index - 1) + 1) - f);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--HasEscapes-->
+		/// @brief Checks if a literal part of a valid format string contains escaped braces.
+		/// @param[in] f The format string.
+		/// @param[in] begin The offset of the literal part.
+		/// @param[in] end The offset behind the literal part.
+		/// @return <span style="color:#30AA00">True</span>, if there is a brace between begin and end.
+		/// @return <span style="color:#CC3000">False</span>, if the literal part is copied as it is.
+		///
+		constexpr bool HasEscapes(const char* f, size_t begin, size_t end) {
+			return begin < end && (f[begin] == '{' || f[begin] == '}' || HasEscapes(f, begin + 1, end));
+		}
+
+		/// @brief A type-erased argument of Power::Format, which knows the length of its characters before they are written.
+		///
+		class FormatArgument {
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a signed integer value.
+			/// @param[in] value The value.
+			///
+			template<typename T>
+			FormatArgument(T value, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type* = nullptr) : kind_(Kind::Signed), size_(0) { signed_ = value; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with an unsigned integer value.
+			/// @param[in] value The value.
+			///
+			template<typename T>
+			FormatArgument(T value, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type* = nullptr) : kind_(Kind::Unsigned), size_(0) { unsigned_ = value; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a bool value, which is written as "true" or "false".
+			/// @param[in] value The value.
+			///
+			FormatArgument(bool value) : kind_(Kind::Text), size_(value ? 4 : 5) { text_ = value ? "true" : "false"; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a character.
+			/// @param[in] c The character.
+			///
+			FormatArgument(char c) : kind_(Kind::Char), size_(1) { char_ = c; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a float value.
+			/// @param[in] value The value.
+			///
+			FormatArgument(float value) : kind_(Kind::Float), size_(0) { float_ = value; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a double value.
+			/// @param[in] value The value.
+			///
+			FormatArgument(double value) : kind_(Kind::Double), size_(0) { double_ = value; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a c-string. Its size is determined once.
+			/// @param[in] cString The c-string.
+			///
+			FormatArgument(const char* const cString) : kind_(Kind::Text), size_(strlen(cString)) { text_ = cString; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a Power::StringView.
+			/// @param[in] view The Power::StringView.
+			///
+			FormatArgument(const StringView& view) : kind_(Kind::Text), size_(view.Size()) { text_ = view.Data(); }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new FormatArgument with a Power::String. Defined in PowerString.h.
+			/// @param[in] string The Power::String.
+			///
+			FormatArgument(const String& string);
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MaxLength-->
+			/// @brief Calculates the number of characters of the argument.
+			/// @param[in] spec The options of the field.
+			/// @return The exact number of characters, or an upper bound for floating point values with a precision.
+			/// @note The shortest digits of floating point values are stored for Write(const FormatSpec&, char*).
+			///
+			inline size_t MaxLength(const FormatSpec& spec) {
+				if (kind_ == Kind::Text) return spec.precision >= 0 && static_cast<size_t>(spec.precision) < size_ ? static_cast<size_t>(spec.precision) : size_;
+				if (kind_ == Kind::Char) return 1;
+				return this->MeasureNumber(spec);
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+			/// @brief Writes the characters of the argument. MaxLength(const FormatSpec&) must be called with the same options first.
+			/// @param[in] spec The options of the field.
+			/// @param[out] destination The buffer receiving the characters. Must hold MaxLength(const FormatSpec&) + 1 characters.
+			/// @return The number of written characters.
+			///
+			inline size_t Write(const FormatSpec& spec, char* destination) const {
+				if (kind_ == Kind::Text) {
+					const size_t size = spec.precision >= 0 && static_cast<size_t>(spec.precision) < size_ ? static_cast<size_t>(spec.precision) : size_;
+					memcpy(destination, text_, size);
+					return size;
+				}
+				if (kind_ == Kind::Char) {
+					*destination = char_;
+					return 1;
+				}
+				return this->WriteNumber(spec, destination);
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PointsInto-->
+			/// @brief Checks if the characters of a string argument are part of a buffer.
+			/// @param[in] data The buffer.
+			/// @param[in] size The number of characters in the buffer.
+			/// @return <span style="color:#30AA00">True</span>, if the argument is a string starting in the buffer.
+			/// @return <span style="color:#CC3000">False</span>, if it is no string or starts outside of the buffer.
+			///
+			inline bool PointsInto(const char* data, size_t size) const {
+				return kind_ == Kind::Text && reinterpret_cast<uintptr_t>(text_) - reinterpret_cast<uintptr_t>(data) < size;
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Relocate-->
+			/// @brief Moves the characters of a string argument which point into a reallocated buffer.
+			/// @param[in] oldData The address of the buffer before the reallocation.
+			/// @param[in] size The number of characters in the buffer.
+			/// @param[in] newData The buffer after the reallocation.
+			///
+			inline void Relocate(uintptr_t oldData, size_t size, const char* newData) {
+				if (kind_ != Kind::Text) return;
+				uintptr_t offset = reinterpret_cast<uintptr_t>(text_) - oldData;
+				if (offset < size) text_ = newData + offset;
+			}
+
+		private:
+			enum class Kind : uint8_t { Signed, Unsigned, Float, Double, Char, Text };
+
+			size_t MeasureNumber(const FormatSpec& spec) {
+				switch (kind_) {
+				case Kind::Signed:
+					if (spec.type != 'x' && spec.type != 'X') return size_ = NumberFormat::Length(signed_);
+					return size_ = (signed_ < 0 ? 1 : 0) + HexLength(signed_ < 0 ? 0 - static_cast<uint64_t>(signed_) : static_cast<uint64_t>(signed_));
+				case Kind::Unsigned:
+					return size_ = spec.type != 'x' && spec.type != 'X' ? NumberFormat::Length(unsigned_) : HexLength(unsigned_);
+				default:
+					if (spec.precision >= 0) return NumberFormat::MaxLength(kind_ == Kind::Float ? float_ : double_, Style(spec), spec.precision);
+					if (kind_ == Kind::Float) NumberFormat::ShortestDecimal(float_, decimal_);
+					else NumberFormat::ShortestDecimal(double_, decimal_);
+					return size_ = NumberFormat::DecimalLength(decimal_, Style(spec));
+				}
+			}
+
+			size_t WriteNumber(const FormatSpec& spec, char* destination) const {
+				switch (kind_) {
+				case Kind::Signed:
+					if (spec.type != 'x' && spec.type != 'X') NumberFormat::Write(signed_, destination, size_);
+					else if (signed_ >= 0) WriteHex(static_cast<uint64_t>(signed_), spec.type == 'X', destination, size_);
+					else {
+						*destination = '-';
+						WriteHex(0 - static_cast<uint64_t>(signed_), spec.type == 'X', destination + 1, size_ - 1);
+					}
+					return size_;
+				case Kind::Unsigned:
+					if (spec.type != 'x' && spec.type != 'X') NumberFormat::Write(unsigned_, destination, size_);
+					else WriteHex(unsigned_, spec.type == 'X', destination, size_);
+					return size_;
+				default:
+					if (spec.precision >= 0) return NumberFormat::FormatPrecise(kind_ == Kind::Float ? float_ : double_, Style(spec), spec.precision, destination);
+					NumberFormat::WriteDecimal(decimal_, Style(spec), destination);
+					return size_;
+				}
+			}
+
+			static inline NumberFormat::FloatStyle Style(const FormatSpec& spec) {
+				return spec.type == 'f' ? NumberFormat::FloatStyle::Fixed : spec.type == 'e' ? NumberFormat::FloatStyle::Scientific : NumberFormat::FloatStyle::General;
+			}
+
+			static inline size_t HexLength(uint64_t value) {
+				return (value >> 32) != 0 ? 9 + Simd::CountLeadingBit(static_cast<uint32_t>(value >> 32)) / 4 : 1 + Simd::CountLeadingBit(static_cast<uint32_t>(value) | 1) / 4;
+			}
+
+			static inline void WriteHex(uint64_t value, bool upperCase, char* destination, size_t length) {
+				const char* const digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+				for (size_t i = length; i > 0; value >>= 4) destination[--i] = digits[value & 0xF];
+			}
+
+			Kind kind_;
+			size_t size_;			///< The size of a string, or the length of an integer or of the shortest digits of a floating point value.
+			union {
+				int64_t signed_;
+				uint64_t unsigned_;
+				float float_;
+				double double_;
+				char char_;
+				const char* text_;
+			};
+			NumberFormat::Decimal decimal_;
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MakeArgument-->
+		/// @brief Creates a FormatArgument for Power::String::Concat and Power::String::AppendAll.
+		/// @param[in] value An integer or floating point value, a bool, a character, a c-string, a Power::StringView or a Power::String.
+		/// @return The FormatArgument.
+		///
+		template<typename T>
+		inline FormatArgument MakeArgument(const T& value) { return FormatArgument(value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a FormatArgument for a character array, e.g. a string literal, without strlen.
+		/// @param[in] array The character array.
+		/// @return The FormatArgument with the characters in front of the first null character, or all N, if there is none.
+		/// @note The size of the array is known at compile time, so the search for the null character is folded for string literals.
+		///
+		template<size_t N>
+		inline FormatArgument MakeArgument(const char (&array)[N]) {
+			const char* end = static_cast<const char*>(memchr(array, '\0', N));
+			return FormatArgument(StringView(array, end != nullptr ? static_cast<size_t>(end - array) : N));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MeasureArguments-->
+		/// @brief Measures arguments which are written without options.
+		/// @param[in] arguments The arguments.
+		/// @param[in] count The number of arguments.
+		/// @return The number of characters of all arguments.
+		///
+		inline size_t MeasureArguments(FormatArgument* arguments, size_t count) {
+			size_t size = 0;
+			for (size_t i = 0; i < count; ++i) size += arguments[i].MaxLength(FormatSpec());
+			return size;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteArguments-->
+		/// @brief Writes arguments without options one after another.
+		/// @param[in] arguments The arguments, measured by MeasureArguments(FormatArgument*, size_t).
+		/// @param[in] count The number of arguments.
+		/// @param[out] destination The buffer receiving the characters. No null character is written.
+		/// @return The number of written characters.
+		///
+		inline size_t WriteArguments(const FormatArgument* arguments, size_t count, char* destination) {
+			char* const begin = destination;
+			for (size_t i = 0; i < count; ++i) destination += arguments[i].Write(FormatSpec(), destination);
+			return destination - begin;
+		}
+
+		/// @brief Formats arguments according to a format string which is validated at compile time.
+		/// @brief The literal parts and the options of the fields are constants, so only the arguments are measured before the single write,
+		/// @brief and the literal parts are copied with their sizes known at compile time.
+		///
+		template<typename FormatString, typename... Args>
+		class Formatter {
+			static_assert(std::is_base_of<FormatStringBase, FormatString>::value, "The format string must be wrapped with POWER_FORMAT(\"...\").");
+			static_assert(CountFields(FormatString::Get()) >= 0, "Invalid format string. Fields are \"{}\" or \"{:[.precision][type]}\", literal braces are written as \"{{\" and \"}}\".");
+			static_assert(CountFields(FormatString::Get()) == static_cast<int32_t>(sizeof...(Args)), "The number of arguments doesn't match the number of fields of the format string.");
+
+		public:
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+			/// @brief Initializes a new Formatter and measures the arguments.
+			/// @param[in] args The arguments, one per field.
+			///
+			explicit Formatter(const Args&... args) : arguments_{ FormatArgument(args)..., FormatArgument('\0') }, maxLength_(0) {
+				maxLength_ = this->Measure(std::index_sequence_for<Args...>());
+			}
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MaxLength-->
+			/// @brief Gets the number of characters to be written.
+			/// @return The exact number of characters, or an upper bound, if floating point values are written with a precision.
+			///
+			inline size_t MaxLength() const { return maxLength_; }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+			/// @brief Writes the formatted characters.
+			/// @param[out] destination The buffer receiving the characters. Must hold MaxLength() + 1 characters. No null character is appended.
+			/// @return The number of written characters.
+			///
+			inline size_t Write(char* destination) const { return this->Write(destination, std::index_sequence_for<Args...>()); }
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Relocate-->
+			/// @brief Moves the string arguments which point into a reallocated buffer.
+			/// @param[in] oldData The address of the buffer before the reallocation.
+			/// @param[in] size The number of characters in the buffer.
+			/// @param[in] newData The buffer after the reallocation.
+			///
+			inline void Relocate(uintptr_t oldData, size_t size, const char* newData) {
+				for (size_t i = 0; i < sizeof...(Args); ++i) arguments_[i].Relocate(oldData, size, newData);
+			}
+
+		private:
+			template<size_t... Indices>
+			inline size_t Measure(std::index_sequence<Indices...>) {
+				constexpr size_t literalLength = LiteralLength(FormatString::Get());
+				const size_t lengths[] = { literalLength, this->MeasureField<Indices>()... };
+				size_t length = 0;
+				for (size_t i = 0; i <= sizeof...(Args); ++i) length += lengths[i];
+				return length;
+			}
+
+			template<size_t Index>
+			inline size_t MeasureField() {
+				constexpr FormatSpec spec = FieldSpec(FormatString::Get(), Index);
+				return arguments_[Index].MaxLength(spec);
+			}
+
+			template<size_t... Indices>
+			inline size_t Write(char* destination, std::index_sequence<Indices...>) const {
+				char* const begin = destination;
+				const int order[] = { 0, (destination = WriteField<Indices>(arguments_[Indices], WriteLiteral<Indices>(destination)), 0)... };
+				(void)order;
+				return WriteLiteral<sizeof...(Args)>(destination) - begin;
+			}
+
+			template<size_t Index>
+			static inline char* WriteField(const FormatArgument& argument, char* destination) {
+				constexpr FormatSpec spec = FieldSpec(FormatString::Get(), Index);
+				return destination + argument.Write(spec, destination);
+			}
+
+			template<size_t Index>
+			static inline char* WriteLiteral(char* destination) {
+				constexpr size_t begin = LiteralBegin(FormatString::Get(), Index);
+				constexpr size_t end = FieldOffset(FormatString::Get(), Index);
+				const char* const format = FormatString::Get();
+				if (!HasEscapes(format, begin, end)) {
+					memcpy(destination, format + begin, end - begin);
+					return destination + (end - begin);
+				}
+				for (size_t i = begin; i < end; ++i) {
+					*destination++ = format[i];
+					i += format[i] == '{' || format[i] == '}';
+				}
+				return destination;
+			}
+
+			FormatArgument arguments_[sizeof...(Args) + 1];
+			size_t maxLength_;
+		};
+	}
+}
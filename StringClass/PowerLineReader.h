@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+
+#ifdef _MSC_VER
+#include <io.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+#include "PowerString.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief Reads the lines of a file stream or a file descriptor one after another through a buffer, which is refilled in place.
+	/// @brief Lines end with LF or CRLF and are found with memchr. The line ending is not part of the line.
+	/// @brief A line is returned as a view into the buffer or copied into a Power::String of the caller, whose capacity is reused,
+	/// \n so reading lines doesn't allocate once the buffer and the Power::String are as large as the longest line.
+	///
+	class LineReader {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a new Power::LineReader of a file stream.
+		/// @param[in] file The file stream. It must be opened in binary mode to keep CRLF, otherwise the C runtime removes the CR.
+		/// @param[in] bufferSize The initial size of the buffer. It is doubled, if a line doesn't fit into it.
+		///
+		explicit LineReader(FILE* file, size_t bufferSize = 64 * 1024) : LineReader(file, -1, bufferSize) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a new Power::LineReader of a file descriptor, bypassing the buffer of the C runtime.
+		/// @param[in] fd The file descriptor.
+		/// @param[in] bufferSize The initial size of the buffer. It is doubled, if a line doesn't fit into it.
+		///
+		explicit LineReader(int fd, size_t bufferSize = 64 * 1024) : LineReader(nullptr, fd, bufferSize) {}
+
+		LineReader(const LineReader&) = delete;
+		LineReader& operator=(const LineReader&) = delete;
+
+		~LineReader() { free(buffer_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ReadLine-->
+		/// @brief Reads the next line without copying it.
+		/// @param[out] line A Power::StringView of the line in the buffer. It is valid until the next line is read.
+		/// @return <span style="color:#30AA00">True</span>, if a line was read.
+		/// @return <span style="color:#CC3000">False</span>, if the end of the input is reached or reading failed (see HasError()).
+		///
+		inline bool ReadLine(StringView& line) {
+			while (true) {
+				const char* lineEnd = static_cast<const char*>(memchr(buffer_ + scanned_, '\n', end_ - scanned_));
+				if (lineEnd != nullptr) {
+					const char* begin = buffer_ + begin_;
+					begin_ = scanned_ = lineEnd + 1 - buffer_;
+					if (lineEnd > begin && lineEnd[-1] == '\r') --lineEnd;
+					line = StringView(begin, lineEnd - begin);
+					return true;
+				}
+				scanned_ = end_;
+				if (endOfInput_) {
+					if (begin_ == end_) return false;
+					line = StringView(buffer_ + begin_, end_ - begin_);
+					begin_ = end_;
+					return true;
+				}
+				this->Refill();
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Reads the next line into a Power::String, reusing its capacity.
+		/// @param[out] line The Power::String receiving the line. It is only reallocated, if the line is larger than its capacity.
+		/// @return <span style="color:#30AA00">True</span>, if a line was read.
+		/// @return <span style="color:#CC3000">False</span>, if the end of the input is reached or reading failed (see HasError()). The Power::String is left unchanged.
+		///
+		inline bool ReadLine(String& line) {
+			StringView view;
+			if (!this->ReadLine(view)) return false;
+			line = "";
+			line.Concatenate(view.Data(), view.Size());
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--HasError-->
+		/// @brief Checks if reading from the file stream or file descriptor failed.
+		/// @return <span style="color:#30AA00">True</span>, if reading failed. The lines read before are valid.
+		/// @return <span style="color:#CC3000">False</span>, if no error occured.
+		///
+		inline bool HasError() const { return error_; }
+
+	private:
+		LineReader(FILE* file, int fd, size_t bufferSize) :
+			file_(file),
+			fd_(fd),
+			buffer_(nullptr),
+			capacity_(bufferSize > 0 ? bufferSize : 1),
+			begin_(0),
+			scanned_(0),
+			end_(0),
+			endOfInput_(false),
+			error_(false)
+		{
+			buffer_ = static_cast<char*>(malloc(capacity_));
+		}
+
+		// Moves the unread characters to the front of the buffer, grows it, if they fill all of it, and reads behind them.
+		inline void Refill() {
+			if (begin_ > 0) {
+				memmove(buffer_, buffer_ + begin_, end_ - begin_);
+				end_ -= begin_;
+				scanned_ -= begin_;
+				begin_ = 0;
+			}
+			if (end_ == capacity_) {
+				capacity_ *= 2;
+				buffer_ = static_cast<char*>(realloc(buffer_, capacity_));
+			}
+			size_t count = this->Read(buffer_ + end_, capacity_ - end_);
+			if (count == 0) endOfInput_ = true;
+			end_ += count;
+		}
+
+		inline size_t Read(char* destination, size_t size) {
+			if (file_ != nullptr) {
+				size_t count = fread(destination, 1, size, file_);
+				if (count == 0 && ferror(file_)) error_ = true;
+				return count;
+			}
+#ifdef _MSC_VER
+			int count = _read(fd_, destination, static_cast<unsigned int>(size < 0x40000000 ? size : 0x40000000));
+#else
+			ssize_t count = read(fd_, destination, size);
+			while (count < 0 && errno == EINTR) count = read(fd_, destination, size);
+#endif
+			if (count < 0) {
+				error_ = true;
+				return 0;
+			}
+			return static_cast<size_t>(count);
+		}
+
+		FILE* file_;
+		int fd_;
+		char* buffer_;
+		size_t capacity_;
+		size_t begin_;			///< The start of the next line in the buffer.
+		size_t scanned_;		///< The end of the characters searched for a newline, so they aren't searched again after a refill.
+		size_t end_;			///< The end of the read characters in the buffer.
+		bool endOfInput_;
+		bool error_;
+	};
+}
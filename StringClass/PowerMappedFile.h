@@ -0,0 +1,229 @@
+#pragma once
+
+#include <cstdint>
+#include <inttypes.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "PowerSplit.h"
+#include "PowerString.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief Options of MappedFile::Open. They can be combined with the bitwise or operator.
+	///
+	enum class MapOptions : uint32_t {
+		None = 0,				///< Pages are read from the page cache or the file, when they are accessed first.
+		Sequential = 1,			///< Hints that the file is read from front to back, so the system reads ahead aggressively.
+		Random = 2,				///< Hints that the file is accessed randomly, so the system doesn't read ahead.
+		Populate = 4,			///< Reads the whole file into the page cache and maps it before Open returns (MAP_POPULATE or PrefetchVirtualMemory).
+		CopyOnWrite = 8			///< Maps the pages writable and private. A page is copied when it is written first, the file itself is never changed.
+	};
+
+	inline MapOptions operator|(MapOptions lhs, MapOptions rhs) { return static_cast<MapOptions>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)); }
+	inline bool operator&(MapOptions lhs, MapOptions rhs) { return (static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)) != 0; }
+
+	/// @brief A file mapped into memory, as an alternative to Power::String::LoadFileIntoString for large files.
+	/// @brief Nothing is copied or allocated: the view of the file points directly at the page cache, so searching and splitting
+	/// \n (see View(), Lines() and Split()) can start right away and only the touched pages need memory.
+	/// @brief With MapOptions::CopyOnWrite, MutableData() can be changed in place and only the written pages are copied.
+	/// \n ToString() copies the file into a Power::String for operations which change its size.
+	/// @note The file is mapped in binary mode, so line endings are kept as they are stored. The data is not null-terminated.
+	///
+	class MappedFile {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a Power::MappedFile, which isn't open yet.
+		///
+		MappedFile() : data_(nullptr), size_(0), open_(false) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a Power::MappedFile and maps the specified file. Check IsOpen() to find out, if it succeeded.
+		/// @param[in] filePath The path of the file to be mapped.
+		/// @param[in] options The MapOptions, e.g. MapOptions::Sequential | MapOptions::Populate.
+		///
+		explicit MappedFile(const char* const filePath, MapOptions options = MapOptions::Sequential) : data_(nullptr), size_(0), open_(false) { this->Open(filePath, options); }
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		~MappedFile() { this->Close(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Open-->
+		/// @brief Maps the specified file. A file mapped before is closed first.
+		/// @param[in] filePath The path of the file to be mapped.
+		/// @param[in] options The MapOptions, e.g. MapOptions::Sequential | MapOptions::Populate.
+		/// @return <span style="color:#30AA00">True</span>, if the file was mapped. An empty file is open with an empty view.
+		/// @return <span style="color:#CC3000">False</span>, if the file couldn't be opened or mapped.
+		///
+		inline bool Open(const String& filePath, MapOptions options = MapOptions::Sequential) { return this->Open(filePath.CString(), options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Maps the specified file. A file mapped before is closed first.
+		/// @param[in] filePath The path of the file to be mapped.
+		/// @param[in] options The MapOptions, e.g. MapOptions::Sequential | MapOptions::Populate.
+		/// @return <span style="color:#30AA00">True</span>, if the file was mapped. An empty file is open with an empty view.
+		/// @return <span style="color:#CC3000">False</span>, if the file couldn't be opened or mapped.
+		///
+		inline bool Open(const char* const filePath, MapOptions options = MapOptions::Sequential) {
+			this->Close();
+#ifdef _WIN32
+			DWORD flags = FILE_ATTRIBUTE_NORMAL;
+			if (options & MapOptions::Sequential) flags |= FILE_FLAG_SEQUENTIAL_SCAN;
+			if (options & MapOptions::Random) flags |= FILE_FLAG_RANDOM_ACCESS;
+			HANDLE file = CreateFileA(filePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+			if (file == INVALID_HANDLE_VALUE) return false;
+			LARGE_INTEGER size;
+			if (!GetFileSizeEx(file, &size)) {
+				CloseHandle(file);
+				return false;
+			}
+			size_ = static_cast<size_t>(size.QuadPart);
+			if (size_ > 0) {
+				bool copyOnWrite = options & MapOptions::CopyOnWrite;
+				HANDLE mapping = CreateFileMappingA(file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+				if (mapping != nullptr) {
+					data_ = static_cast<char*>(MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0));
+					// The view keeps the mapping alive.
+					CloseHandle(mapping);
+				}
+#if _WIN32_WINNT >= 0x0602
+				if (data_ != nullptr && (options & MapOptions::Populate)) {
+					WIN32_MEMORY_RANGE_ENTRY range = { data_, size_ };
+					PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+				}
+#endif
+			}
+			CloseHandle(file);
+			if (size_ > 0 && data_ == nullptr) {
+				size_ = 0;
+				return false;
+			}
+#else
+			int fd = open(filePath, O_RDONLY);
+			if (fd < 0) return false;
+			struct stat status;
+			if (fstat(fd, &status) != 0) {
+				close(fd);
+				return false;
+			}
+			size_ = static_cast<size_t>(status.st_size);
+			if (size_ > 0) {
+				int protection = PROT_READ;
+				int flags = MAP_SHARED;
+				if (options & MapOptions::CopyOnWrite) {
+					protection |= PROT_WRITE;
+					flags = MAP_PRIVATE;
+				}
+#ifdef MAP_POPULATE
+				if (options & MapOptions::Populate) flags |= MAP_POPULATE;
+#endif
+				void* data = mmap(nullptr, size_, protection, flags, fd, 0);
+				if (data != MAP_FAILED) {
+					data_ = static_cast<char*>(data);
+					if (options & MapOptions::Sequential) madvise(data_, size_, MADV_SEQUENTIAL);
+					if (options & MapOptions::Random) madvise(data_, size_, MADV_RANDOM);
+#ifndef MAP_POPULATE
+					if (options & MapOptions::Populate) madvise(data_, size_, MADV_WILLNEED);
+#endif
+				}
+			}
+			// The mapping keeps the file alive.
+			close(fd);
+			if (size_ > 0 && data_ == nullptr) {
+				size_ = 0;
+				return false;
+			}
+#endif
+			open_ = true;
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Close-->
+		/// @brief Unmaps the file. Views of it are invalidated and changes made with MapOptions::CopyOnWrite are discarded.
+		///
+		inline void Close() {
+			if (data_ != nullptr) {
+#ifdef _WIN32
+				UnmapViewOfFile(data_);
+#else
+				munmap(data_, size_);
+#endif
+			}
+			data_ = nullptr;
+			size_ = 0;
+			open_ = false;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsOpen-->
+		/// @brief Checks if a file is mapped.
+		/// @return <span style="color:#30AA00">True</span>, if a file is mapped.
+		/// @return <span style="color:#CC3000">False</span>, if no file is mapped or mapping it failed.
+		///
+		inline bool IsOpen() const { return open_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Data-->
+		/// @brief Gets the mapped characters.
+		/// @return A pointer to the first character of the file or nullptr, if it is empty or not open.
+		///
+		inline const char* Data() const { return data_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MutableData-->
+		/// @brief Gets the mapped characters for writing. Only valid, if the file was opened with MapOptions::CopyOnWrite.
+		/// @return A pointer to the first character of the file or nullptr, if it is empty or not open.
+		/// @note Each page is copied when it is written first. The file is never changed.
+		///
+		inline char* MutableData() { return data_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the size of the file.
+		/// @return The number of mapped characters.
+		///
+		inline size_t Size() const { return size_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--View-->
+		/// @brief Creates a view of the whole file without copying.
+		/// @return A Power::StringView of the mapped characters. It is valid until the file is closed.
+		///
+		inline StringView View() const { return data_ != nullptr ? StringView(data_, size_) : StringView(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Lines-->
+		/// @brief Splits the file into lines ending with LF or CRLF without copying.
+		/// @return A lazy LineRange of Power::StringViews without the line endings. They are valid until the file is closed.
+		///
+		inline LineRange Lines() const { return this->View().Lines(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Split-->
+		/// @brief Splits the file at each occurance of a character without copying.
+		/// @param[in] c The delimiter.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @return A lazy SplitRange of Power::StringViews. They are valid until the file is closed.
+		///
+		inline SplitRange Split(const char c, SplitOptions options = SplitOptions::None) const { return this->View().Split(c, options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToString-->
+		/// @brief Copies the file into a new Power::String, e.g. to change its size.
+		/// @return A new Power::String containing the mapped characters.
+		///
+		inline String ToString() const { return data_ != nullptr ? String(data_, size_) : String(); }
+
+	private:
+		char* data_;
+		size_t size_;
+		bool open_;
+	};
+}
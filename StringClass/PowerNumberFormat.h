@@ -0,0 +1,588 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <inttypes.h>
+
+#include "PowerSimd.h"
+
+
+namespace Power {
+	namespace NumberFormat {
+		/// @brief The decimal digits of 00 to 99, two characters each, so two digits are written with one division by 100.
+		///
+		const char kDigitPairs[201] =
+			"00010203040506070809"
+			"10111213141516171819"
+			"20212223242526272829"
+			"30313233343536373839"
+			"40414243444546474849"
+			"50515253545556575859"
+			"60616263646566676869"
+			"70717273747576777879"
+			"80818283848586878889"
+			"90919293949596979899";
+
+		/// @brief The powers of ten from 10^0 to 10^19.
+		///
+		const uint64_t kPowersOfTen[20] = {
+			1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+			10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+			10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountDigits-->
+		/// @brief Counts the decimal digits of an unsigned integer value without a loop.
+		/// @param[in] value The value.
+		/// @return The number of digits, 1 to 10.
+		/// @note The bit length times log10(2) (1233 / 4096) is one too small at most, which a single comparison with a power of ten corrects.
+		/// \n The lowest bit is set, so 0 is counted like 1. No other power of ten is odd.
+		///
+		inline uint32_t CountDigits(uint32_t value) {
+			value |= 1;
+			uint32_t estimate = ((Simd::CountLeadingBit(value) + 1) * 1233) >> 12;
+			return estimate + 1 - (value < kPowersOfTen[estimate]);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Counts the decimal digits of an unsigned long long value without a loop.
+		/// @param[in] value The value.
+		/// @return The number of digits, 1 to 20.
+		///
+		inline uint32_t CountDigits(uint64_t value) {
+			if ((value >> 32) == 0) return CountDigits(static_cast<uint32_t>(value));
+			uint32_t estimate = ((Simd::CountLeadingBit(static_cast<uint32_t>(value >> 32)) + 33) * 1233) >> 12;
+			return estimate + 1 - (value < kPowersOfTen[estimate]);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteDigits-->
+		/// @brief Writes the decimal digits of an unsigned integer value backwards, two at a time.
+		/// @param[in] value The value.
+		/// @param[out] end The position behind the last digit. CountDigits(uint32_t) characters in front of it are written.
+		///
+		inline void WriteDigits(uint32_t value, char* end) {
+			while (value >= 100) {
+				uint32_t pair = (value % 100) * 2;
+				value /= 100;
+				end -= 2;
+				end[0] = kDigitPairs[pair];
+				end[1] = kDigitPairs[pair + 1];
+			}
+			if (value >= 10) {
+				end[-2] = kDigitPairs[value * 2];
+				end[-1] = kDigitPairs[value * 2 + 1];
+			} else {
+				end[-1] = static_cast<char>('0' + value);
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes the decimal digits of an unsigned long long value backwards, two at a time.
+		/// @param[in] value The value.
+		/// @param[out] end The position behind the last digit. CountDigits(uint64_t) characters in front of it are written.
+		/// @note Blocks of eight digits are split off with a 64-bit division, the rest is written with 32-bit divisions.
+		///
+		inline void WriteDigits(uint64_t value, char* end) {
+			while ((value >> 32) != 0) {
+				uint64_t high = value / 100000000;
+				uint32_t low = static_cast<uint32_t>(value - high * 100000000);
+				for (int i = 0; i < 4; ++i) {
+					uint32_t pair = (low % 100) * 2;
+					low /= 100;
+					end -= 2;
+					end[0] = kDigitPairs[pair];
+					end[1] = kDigitPairs[pair + 1];
+				}
+				value = high;
+			}
+			WriteDigits(static_cast<uint32_t>(value), end);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Length-->
+		/// @brief Calculates the number of characters of a signed integer value.
+		/// @param[in] value The value.
+		/// @return The number of characters including the minus sign.
+		///
+		inline size_t Length(int32_t value) { return value < 0 ? 1 + CountDigits(0u - static_cast<uint32_t>(value)) : CountDigits(static_cast<uint32_t>(value)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Calculates the number of characters of an unsigned integer value.
+		/// @param[in] value The value.
+		/// @return The number of characters.
+		///
+		inline size_t Length(uint32_t value) { return CountDigits(value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Calculates the number of characters of a signed long long value.
+		/// @param[in] value The value.
+		/// @return The number of characters including the minus sign.
+		///
+		inline size_t Length(int64_t value) { return value < 0 ? 1 + CountDigits(0 - static_cast<uint64_t>(value)) : CountDigits(static_cast<uint64_t>(value)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Calculates the number of characters of an unsigned long long value.
+		/// @param[in] value The value.
+		/// @return The number of characters.
+		///
+		inline size_t Length(uint64_t value) { return CountDigits(value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+		/// @brief Writes a signed integer value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. No null character is written.
+		/// @param[in] length The number of characters as returned by Length(int32_t).
+		///
+		inline void Write(int32_t value, char* destination, size_t length) {
+			if (value < 0) *destination = '-';
+			WriteDigits(value < 0 ? 0u - static_cast<uint32_t>(value) : static_cast<uint32_t>(value), destination + length);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes an unsigned integer value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. No null character is written.
+		/// @param[in] length The number of characters as returned by Length(uint32_t).
+		///
+		inline void Write(uint32_t value, char* destination, size_t length) { WriteDigits(value, destination + length); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes a signed long long value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. No null character is written.
+		/// @param[in] length The number of characters as returned by Length(int64_t).
+		///
+		inline void Write(int64_t value, char* destination, size_t length) {
+			if (value < 0) *destination = '-';
+			WriteDigits(value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value), destination + length);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes an unsigned long long value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. No null character is written.
+		/// @param[in] length The number of characters as returned by Length(uint64_t).
+		///
+		inline void Write(uint64_t value, char* destination, size_t length) { WriteDigits(value, destination + length); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Format-->
+		/// @brief Formats a signed integer value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. Must hold INT32_MAX_CHR_COUNT - 1 characters. No null character is written.
+		/// @return The number of written characters.
+		///
+		inline size_t Format(int32_t value, char* destination) {
+			size_t length = Length(value);
+			Write(value, destination, length);
+			return length;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Formats an unsigned integer value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. Must hold UINT32_MAX_CHR_COUNT - 1 characters. No null character is written.
+		/// @return The number of written characters.
+		///
+		inline size_t Format(uint32_t value, char* destination) {
+			size_t length = Length(value);
+			Write(value, destination, length);
+			return length;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Formats a signed long long value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. Must hold INT64_MAX_CHR_COUNT - 1 characters. No null character is written.
+		/// @return The number of written characters.
+		///
+		inline size_t Format(int64_t value, char* destination) {
+			size_t length = Length(value);
+			Write(value, destination, length);
+			return length;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Formats an unsigned long long value in decimal.
+		/// @param[in] value The value.
+		/// @param[out] destination The buffer receiving the characters. Must hold UINT64_MAX_CHR_COUNT - 1 characters. No null character is written.
+		/// @return The number of written characters.
+		///
+		inline size_t Format(uint64_t value, char* destination) {
+			size_t length = Length(value);
+			Write(value, destination, length);
+			return length;
+		}
+
+		/// @brief The notation of a formatted floating point value.
+		///
+		enum class FloatStyle {
+			General,		///< Fixed notation for decimal exponents from -4 up to the significant digits of the type, scientific notation otherwise, like %g.
+			Fixed,			///< Fixed notation without exponent, like %f.
+			Scientific		///< One digit in front of the decimal point and an exponent of at least two digits, like %e.
+		};
+
+		/// @brief A decimal floating point value with the fewest significant digits which are read back as the same float or double.
+		/// @brief The digits are found with Grisu2, which always round-trips and gives the shortest digits for more than 99.9 % of the values.
+		/// @brief For the rest, e.g. 1e23, it gives one digit more ("9.999999999999999e+22").
+		///
+		struct Decimal {
+			char digits[20];		///< The significant digits without trailing zeros, or "inf" or "nan", if the value is not finite.
+			int32_t count;			///< The number of digits.
+			int32_t exponent;		///< The decimal exponent of the last digit.
+			int32_t maxDigits;		///< The number of digits needed to round-trip any value of the type, 9 for float and 17 for double.
+			bool negative;			///< The sign bit of the value. Not set for NaN.
+			bool finite;			///< The value is neither infinite nor NaN.
+		};
+
+		/// @brief A floating point value with a 64-bit significand, the value is f * 2^e.
+		///
+		struct DiyFp {
+			uint64_t f;
+			int32_t e;
+		};
+
+		/// @brief The normalized significands of the powers of ten 10^-348 to 10^340 in steps of 8, rounded to the nearest.
+		///
+		const uint64_t kCachedPowerSignificands[87] = {
+			0xFA8FD5A0081C0288ull, 0xBAAEE17FA23EBF76ull, 0x8B16FB203055AC76ull, 0xCF42894A5DCE35EAull,
+			0x9A6BB0AA55653B2Dull, 0xE61ACF033D1A45DFull, 0xAB70FE17C79AC6CAull, 0xFF77B1FCBEBCDC4Full,
+			0xBE5691EF416BD60Cull, 0x8DD01FAD907FFC3Cull, 0xD3515C2831559A83ull, 0x9D71AC8FADA6C9B5ull,
+			0xEA9C227723EE8BCBull, 0xAECC49914078536Dull, 0x823C12795DB6CE57ull, 0xC21094364DFB5637ull,
+			0x9096EA6F3848984Full, 0xD77485CB25823AC7ull, 0xA086CFCD97BF97F4ull, 0xEF340A98172AACE5ull,
+			0xB23867FB2A35B28Eull, 0x84C8D4DFD2C63F3Bull, 0xC5DD44271AD3CDBAull, 0x936B9FCEBB25C996ull,
+			0xDBAC6C247D62A584ull, 0xA3AB66580D5FDAF6ull, 0xF3E2F893DEC3F126ull, 0xB5B5ADA8AAFF80B8ull,
+			0x87625F056C7C4A8Bull, 0xC9BCFF6034C13053ull, 0x964E858C91BA2655ull, 0xDFF9772470297EBDull,
+			0xA6DFBD9FB8E5B88Full, 0xF8A95FCF88747D94ull, 0xB94470938FA89BCFull, 0x8A08F0F8BF0F156Bull,
+			0xCDB02555653131B6ull, 0x993FE2C6D07B7FACull, 0xE45C10C42A2B3B06ull, 0xAA242499697392D3ull,
+			0xFD87B5F28300CA0Eull, 0xBCE5086492111AEBull, 0x8CBCCC096F5088CCull, 0xD1B71758E219652Cull,
+			0x9C40000000000000ull, 0xE8D4A51000000000ull, 0xAD78EBC5AC620000ull, 0x813F3978F8940984ull,
+			0xC097CE7BC90715B3ull, 0x8F7E32CE7BEA5C70ull, 0xD5D238A4ABE98068ull, 0x9F4F2726179A2245ull,
+			0xED63A231D4C4FB27ull, 0xB0DE65388CC8ADA8ull, 0x83C7088E1AAB65DBull, 0xC45D1DF942711D9Aull,
+			0x924D692CA61BE758ull, 0xDA01EE641A708DEAull, 0xA26DA3999AEF774Aull, 0xF209787BB47D6B85ull,
+			0xB454E4A179DD1877ull, 0x865B86925B9BC5C2ull, 0xC83553C5C8965D3Dull, 0x952AB45CFA97A0B3ull,
+			0xDE469FBD99A05FE3ull, 0xA59BC234DB398C25ull, 0xF6C69A72A3989F5Cull, 0xB7DCBF5354E9BECEull,
+			0x88FCF317F22241E2ull, 0xCC20CE9BD35C78A5ull, 0x98165AF37B2153DFull, 0xE2A0B5DC971F303Aull,
+			0xA8D9D1535CE3B396ull, 0xFB9B7CD9A4A7443Cull, 0xBB764C4CA7A44410ull, 0x8BAB8EEFB6409C1Aull,
+			0xD01FEF10A657842Cull, 0x9B10A4E5E9913129ull, 0xE7109BFBA19C0C9Dull, 0xAC2820D9623BF429ull,
+			0x80444B5E7AA7CF85ull, 0xBF21E44003ACDD2Dull, 0x8E679C2F5E44FF8Full, 0xD433179D9C8CB841ull,
+			0x9E19DB92B4E31BA9ull, 0xEB96BF6EBADF77D9ull, 0xAF87023B9BF0EE6Bull,
+		};
+
+		/// @brief The binary exponents of kCachedPowerSignificands.
+		///
+		const int16_t kCachedPowerExponents[87] = {
+			-1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927, -901, -874, -847, -821,
+			-794, -768, -741, -715, -688, -661, -635, -608, -582, -555, -529, -502, -475, -449, -422, -396,
+			-369, -343, -316, -289, -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+			56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348, 375, 402, 428, 455,
+			481, 508, 534, 561, 588, 614, 641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+			907, 933, 960, 986, 1013, 1039, 1066,
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Multiply-->
+		/// @brief Multiplies two DiyFps and rounds the product to 64 bits.
+		/// @param[in] lhs The first factor.
+		/// @param[in] rhs The second factor.
+		/// @return The upper 64 bits of the product.
+		///
+		inline DiyFp Multiply(const DiyFp& lhs, const DiyFp& rhs) {
+			const uint64_t a = lhs.f >> 32;
+			const uint64_t b = lhs.f & 0xFFFFFFFF;
+			const uint64_t c = rhs.f >> 32;
+			const uint64_t d = rhs.f & 0xFFFFFFFF;
+			const uint64_t bd = b * d;
+			const uint64_t ad = a * d;
+			const uint64_t bc = b * c;
+			const uint64_t middle = (bd >> 32) + (ad & 0xFFFFFFFF) + (bc & 0xFFFFFFFF) + (1ull << 31);
+			DiyFp product = { a * c + (ad >> 32) + (bc >> 32) + (middle >> 32), lhs.e + rhs.e + 64 };
+			return product;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Normalize-->
+		/// @brief Shifts the significand of a DiyFp until its highest bit is set.
+		/// @param[in] value The DiyFp. Its significand must not be 0.
+		/// @return The normalized DiyFp of the same value.
+		///
+		inline DiyFp Normalize(const DiyFp& value) {
+			const uint32_t high = static_cast<uint32_t>(value.f >> 32);
+			const int32_t shift = high != 0 ? 31 - static_cast<int32_t>(Simd::CountLeadingBit(high)) : 63 - static_cast<int32_t>(Simd::CountLeadingBit(static_cast<uint32_t>(value.f)));
+			DiyFp normalized = { value.f << shift, value.e - shift };
+			return normalized;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CachedPower-->
+		/// @brief Selects the cached power of ten, which brings the product with a DiyFp of the specified exponent into the range of 2^-60 to 2^-32.
+		/// @param[in] e The binary exponent of the normalized DiyFp.
+		/// @param[out] decimalExponent The decimal exponent, which undoes the multiplication with the power of ten.
+		/// @return The cached power of ten.
+		///
+		inline DiyFp CachedPower(int32_t e, int32_t& decimalExponent) {
+			const double estimate = (-61 - e) * 0.30102999566398114 + 347;
+			int32_t k = static_cast<int32_t>(estimate);
+			if (estimate - k > 0.0) ++k;
+			const int32_t index = (k >> 3) + 1;
+			decimalExponent = 348 - index * 8;
+			DiyFp power = { kCachedPowerSignificands[index], kCachedPowerExponents[index] };
+			return power;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--GrisuRound-->
+		/// @brief Decrements the last generated digit as long as the result moves closer to the value and stays inside the rounding interval.
+		///
+		inline void GrisuRound(char* digits, int32_t count, uint64_t delta, uint64_t rest, uint64_t tenKappa, uint64_t distance) {
+			while (rest < distance && delta - rest >= tenKappa && (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance)) {
+				--digits[count - 1];
+				rest += tenKappa;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--GenerateDigits-->
+		/// @brief Generates the digits of the upper boundary until the rest is inside the rounding interval (Grisu2 by Florian Loitsch).
+		///
+		inline void GenerateDigits(const DiyFp& value, const DiyFp& upper, uint64_t delta, Decimal& decimal) {
+			const uint32_t shift = static_cast<uint32_t>(-upper.e);
+			const uint64_t one = 1ull << shift;
+			const uint64_t distance = upper.f - value.f;
+			uint32_t integral = static_cast<uint32_t>(upper.f >> shift);
+			uint64_t fraction = upper.f & (one - 1);
+			int32_t kappa = static_cast<int32_t>(CountDigits(integral));
+			decimal.count = 0;
+			while (kappa > 0) {
+				const uint32_t divisor = static_cast<uint32_t>(kPowersOfTen[kappa - 1]);
+				const uint32_t digit = integral / divisor;
+				integral %= divisor;
+				if (digit != 0 || decimal.count != 0) decimal.digits[decimal.count++] = static_cast<char>('0' + digit);
+				--kappa;
+				const uint64_t rest = (static_cast<uint64_t>(integral) << shift) + fraction;
+				if (rest <= delta) {
+					decimal.exponent += kappa;
+					GrisuRound(decimal.digits, decimal.count, delta, rest, kPowersOfTen[kappa] << shift, distance);
+					return;
+				}
+			}
+			for (;;) {
+				fraction *= 10;
+				delta *= 10;
+				const uint32_t digit = static_cast<uint32_t>(fraction >> shift);
+				if (digit != 0 || decimal.count != 0) decimal.digits[decimal.count++] = static_cast<char>('0' + digit);
+				fraction &= one - 1;
+				--kappa;
+				if (fraction < delta) {
+					decimal.exponent += kappa;
+					GrisuRound(decimal.digits, decimal.count, delta, fraction, one, -kappa < 20 ? distance * kPowersOfTen[-kappa] : 0);
+					return;
+				}
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Grisu2-->
+		/// @brief Finds the shortest digits inside the rounding interval of a positive binary floating point value.
+		/// @param[in] f The significand including the hidden bit.
+		/// @param[in] e The binary exponent.
+		/// @param[in] lowerCloser The significand is a power of two and not the smallest normal one, so the next lower value is half as far away.
+		/// @param[out] decimal The Decimal receiving the digits and their exponent.
+		///
+		inline void Grisu2(uint64_t f, int32_t e, bool lowerCloser, Decimal& decimal) {
+			DiyFp plusBoundary = { (f << 1) + 1, e - 1 };
+			const DiyFp plus = Normalize(plusBoundary);
+			DiyFp minus = lowerCloser ? DiyFp{ (f << 2) - 1, e - 2 } : DiyFp{ (f << 1) - 1, e - 1 };
+			minus.f <<= minus.e - plus.e;
+			minus.e = plus.e;
+
+			int32_t decimalExponent;
+			const DiyFp power = CachedPower(plus.e, decimalExponent);
+			DiyFp valueFp = { f, e };
+			const DiyFp value = Multiply(Normalize(valueFp), power);
+			DiyFp upper = Multiply(plus, power);
+			DiyFp lower = Multiply(minus, power);
+			++lower.f;
+			--upper.f;
+			decimal.exponent = decimalExponent;
+			GenerateDigits(value, upper, upper.f - lower.f, decimal);
+			while (decimal.count > 1 && decimal.digits[decimal.count - 1] == '0') {
+				--decimal.count;
+				++decimal.exponent;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ShortestDecimal-->
+		/// @brief Converts a double value to the shortest decimal, which is read back as the same double value.
+		/// @param[in] value The value.
+		/// @param[out] decimal The Decimal receiving the digits.
+		///
+		inline void ShortestDecimal(double value, Decimal& decimal) {
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const uint64_t significand = bits & 0xFFFFFFFFFFFFFull;
+			const int32_t biasedExponent = static_cast<int32_t>((bits >> 52) & 0x7FF);
+			decimal.negative = (bits >> 63) != 0;
+			decimal.finite = biasedExponent != 0x7FF;
+			decimal.maxDigits = 17;
+			if (!decimal.finite || (biasedExponent == 0 && significand == 0)) {
+				if (!decimal.finite && significand != 0) decimal.negative = false;
+				decimal.count = decimal.finite ? 1 : 3;
+				memcpy(decimal.digits, decimal.finite ? "0" : significand != 0 ? "nan" : "inf", decimal.count);
+				decimal.exponent = 0;
+				return;
+			}
+			if (biasedExponent == 0) Grisu2(significand, -1074, false, decimal);
+			else Grisu2(significand | (1ull << 52), biasedExponent - 1075, significand == 0 && biasedExponent > 1, decimal);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Converts a float value to the shortest decimal, which is read back as the same float value.
+		/// @param[in] value The value.
+		/// @param[out] decimal The Decimal receiving the digits.
+		/// @note The rounding interval is the one of the float, so e.g. 0.1f gives "0.1" and not the 9 digits of its double value.
+		///
+		inline void ShortestDecimal(float value, Decimal& decimal) {
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			const uint32_t significand = bits & 0x7FFFFF;
+			const int32_t biasedExponent = static_cast<int32_t>((bits >> 23) & 0xFF);
+			decimal.negative = (bits >> 31) != 0;
+			decimal.finite = biasedExponent != 0xFF;
+			decimal.maxDigits = 9;
+			if (!decimal.finite || (biasedExponent == 0 && significand == 0)) {
+				if (!decimal.finite && significand != 0) decimal.negative = false;
+				decimal.count = decimal.finite ? 1 : 3;
+				memcpy(decimal.digits, decimal.finite ? "0" : significand != 0 ? "nan" : "inf", decimal.count);
+				decimal.exponent = 0;
+				return;
+			}
+			if (biasedExponent == 0) Grisu2(significand, -149, false, decimal);
+			else Grisu2(significand | (1u << 23), biasedExponent - 150, significand == 0 && biasedExponent > 1, decimal);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--DecimalLength-->
+		/// @brief Calculates the number of characters of a Decimal in the specified notation.
+		/// @param[in] decimal The Decimal.
+		/// @param[in] style The notation.
+		/// @return The number of characters including the sign.
+		///
+		inline size_t DecimalLength(const Decimal& decimal, FloatStyle style) {
+			size_t length = decimal.negative ? 1 : 0;
+			if (!decimal.finite) return length + 3;
+			const int32_t point = decimal.count + decimal.exponent;
+			if (style == FloatStyle::General) style = point - 1 < -4 || point - 1 >= decimal.maxDigits ? FloatStyle::Scientific : FloatStyle::Fixed;
+			if (style == FloatStyle::Scientific) {
+				const int32_t exponent = point - 1 < 0 ? 1 - point : point - 1;
+				return length + decimal.count + (decimal.count > 1 ? 1 : 0) + 2 + (exponent >= 100 ? 3 : 2);
+			}
+			if (point <= 0) return length + 2 - point + decimal.count;
+			if (point < decimal.count) return length + decimal.count + 1;
+			return length + point;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteDecimal-->
+		/// @brief Writes a Decimal in the specified notation.
+		/// @param[in] decimal The Decimal.
+		/// @param[in] style The notation.
+		/// @param[out] destination The buffer receiving the characters. Must hold DecimalLength(const Decimal&, FloatStyle) characters.
+		/// \n No null character is written.
+		///
+		inline void WriteDecimal(const Decimal& decimal, FloatStyle style, char* destination) {
+			if (decimal.negative) *destination++ = '-';
+			if (!decimal.finite) {
+				memcpy(destination, decimal.digits, 3);
+				return;
+			}
+			const int32_t point = decimal.count + decimal.exponent;
+			if (style == FloatStyle::General) style = point - 1 < -4 || point - 1 >= decimal.maxDigits ? FloatStyle::Scientific : FloatStyle::Fixed;
+			if (style == FloatStyle::Scientific) {
+				*destination++ = decimal.digits[0];
+				if (decimal.count > 1) {
+					*destination++ = '.';
+					memcpy(destination, decimal.digits + 1, decimal.count - 1);
+					destination += decimal.count - 1;
+				}
+				*destination++ = 'e';
+				*destination++ = point - 1 < 0 ? '-' : '+';
+				const uint32_t exponent = static_cast<uint32_t>(point - 1 < 0 ? 1 - point : point - 1);
+				WriteDigits(exponent, destination + (exponent >= 100 ? 3 : 2));
+				if (exponent < 10) *destination = '0';
+			} else if (point <= 0) {
+				destination[0] = '0';
+				destination[1] = '.';
+				memset(destination + 2, '0', -point);
+				memcpy(destination + 2 - point, decimal.digits, decimal.count);
+			} else if (point < decimal.count) {
+				memcpy(destination, decimal.digits, point);
+				destination[point] = '.';
+				memcpy(destination + point + 1, decimal.digits + point, decimal.count - point);
+			} else {
+				memcpy(destination, decimal.digits, decimal.count);
+				memset(destination + decimal.count, '0', point - decimal.count);
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MaxLength-->
+		/// @brief Calculates the maximum number of characters of a double value formatted with a fixed number of digits.
+		/// @param[in] value The value.
+		/// @param[in] style The notation.
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for FloatStyle::General.
+		/// @return The maximum number of characters excluding the null character.
+		/// @note The integral digits of the fixed notation are estimated from the binary exponent, which overestimates them by one at most.
+		///
+		inline size_t MaxLength(double value, FloatStyle style, int32_t precision) {
+			const size_t digits = precision > 0 ? static_cast<size_t>(precision) : 1;
+			if (style != FloatStyle::Fixed) return 1 + 1 + 1 + digits + 5;
+			int exponent = 0;
+			if (value - value == 0.0) frexp(value, &exponent);
+			const size_t integralDigits = exponent > 0 ? static_cast<size_t>(exponent) * 30103 / 100000 + 2 : 4;
+			return 1 + integralDigits + 1 + digits;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FormatFixed-->
+		/// @brief Formats a double value in fixed notation without snprintf, if the rounding is unambiguous.
+		/// @param[in] value The value.
+		/// @param[in] precision The number of digits behind the decimal point, 0 to 15.
+		/// @param[out] destination The buffer receiving the characters and a null character. Must hold MaxLength(double, FloatStyle, int32_t) + 1 characters.
+		/// @return The number of written characters excluding the null character, or 0, if snprintf has to round the value.
+		/// @note The value is scaled by 10^precision, which is off by half an ulp at most. If the fraction isn't that close to one half,
+		/// \n the scaled value rounds to the same integer as the exact decimal value, like snprintf does.
+		///
+		inline size_t FormatFixed(double value, int32_t precision, char* destination) {
+			const double scaled = fabs(value) * static_cast<double>(kPowersOfTen[precision]);
+			if (!(scaled < 9007199254740992.0)) return 0;
+			const double integral = floor(scaled);
+			const double fraction = scaled - integral;
+			if (fabs(fraction - 0.5) <= scaled * 2.3e-16) return 0;
+			const uint64_t digits = static_cast<uint64_t>(integral) + (fraction > 0.5 ? 1 : 0);
+			const uint64_t integralDigits = digits / kPowersOfTen[precision];
+			const bool negative = std::signbit(value);
+			const size_t integralLength = CountDigits(integralDigits);
+			const size_t length = (negative ? 1 : 0) + integralLength + (precision > 0 ? 1 + precision : 0);
+			char* end = destination + length;
+			*end = '\0';
+			if (precision > 0) {
+				uint64_t fractionDigits = digits - integralDigits * kPowersOfTen[precision];
+				for (int32_t i = 0; i < precision; ++i, fractionDigits /= 10) *--end = static_cast<char>('0' + fractionDigits % 10);
+				*--end = '.';
+			}
+			WriteDigits(integralDigits, end);
+			if (negative) *destination = '-';
+			return length;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FormatPrecise-->
+		/// @brief Formats a double value with a fixed number of digits, correctly rounded like by the C runtime.
+		/// @param[in] value The value.
+		/// @param[in] style The notation.
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for FloatStyle::General.
+		/// @param[out] destination The buffer receiving the characters and a null character. Must hold MaxLength(double, FloatStyle, int32_t) + 1 characters.
+		/// @return The number of written characters excluding the null character.
+		/// @note The fixed notation of values below 2^53 / 10^precision is written by FormatFixed(double, int32_t, char*), everything else by snprintf.
+		///
+		inline size_t FormatPrecise(double value, FloatStyle style, int32_t precision, char* destination) {
+			if (style == FloatStyle::Fixed && precision >= 0 && precision <= 15) {
+				const size_t length = FormatFixed(value, precision, destination);
+				if (length != 0) return length;
+			}
+			const char* const format = style == FloatStyle::Fixed ? "%.*f" : style == FloatStyle::Scientific ? "%.*e" : "%.*g";
+			int written = snprintf(destination, MaxLength(value, style, precision) + 1, format, precision < 0 ? 0 : static_cast<int>(precision), value);
+			return written < 0 ? 0 : static_cast<size_t>(written);
+		}
+	}
+}
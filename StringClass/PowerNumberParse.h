@@ -0,0 +1,410 @@
+#pragma once
+
+#include <clocale>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+#include <limits>
+
+#include "PowerPowersOfFive.h"
+#include "PowerSimd.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+
+namespace Power {
+	namespace NumberParse {
+		/// @brief The reason a number couldn't be parsed.
+		///
+		enum class ParseError {
+			None,			///< The number has been parsed.
+			Invalid,		///< The characters don't start with a number.
+			OutOfRange		///< The number doesn't fit into the type. The value is left unchanged.
+		};
+
+		/// @brief The result of parsing a number from the start of a sequence of characters, like std::from_chars.
+		///
+		struct ParseResult {
+			size_t consumed;		///< The number of characters which are part of the number. 0, if the characters don't start with a number.
+			ParseError error;		///< ParseError::None, if the value has been written.
+		};
+
+		/// @brief A double value as significand and biased exponent, the result of ComputeDouble(int64_t, uint64_t).
+		///
+		struct BinaryDouble {
+			uint64_t significand;	///< The significand without the hidden bit.
+			int32_t exponent;		///< The biased exponent. -1, if the value couldn't be computed exactly.
+		};
+
+		/// @brief The powers of ten which are exactly representable as double.
+		///
+		const double kExactPowersOfTen[23] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsDigit-->
+		/// @brief Checks if a character is a decimal digit.
+		/// @param[in] c The character.
+		/// @return <span style="color:#30AA00">True</span>, if the character is '0' to '9'.
+		/// @return <span style="color:#CC3000">False</span>, if it isn't.
+		///
+		inline bool IsDigit(char c) { return static_cast<uint8_t>(c - '0') < 10; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsEightDigits-->
+		/// @brief Checks if eight characters, loaded as little endian integer, are all decimal digits.
+		/// @param[in] chunk The eight characters.
+		/// @return <span style="color:#30AA00">True</span>, if all characters are '0' to '9'.
+		/// @return <span style="color:#CC3000">False</span>, if at least one isn't.
+		/// @note Every byte must be 0x30-0x39: its high nibble is 3 and adding 6 doesn't carry into it.
+		///
+		inline bool IsEightDigits(uint64_t chunk) {
+			return ((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseEightDigits-->
+		/// @brief Converts eight decimal digits, loaded as little endian integer, with three multiplications instead of eight.
+		/// @param[in] chunk The eight digits, checked with IsEightDigits(uint64_t).
+		/// @return The value of the digits, 0 to 99999999.
+		/// @note Neighbouring digits are combined to pairs, pairs to quadruples and quadruples to the result, each step with one 64-bit multiplication.
+		///
+		inline uint32_t ParseEightDigits(uint64_t chunk) {
+			chunk = ((chunk & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+			chunk = ((chunk & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+			return static_cast<uint32_t>(((chunk & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LoadEight-->
+		/// @brief Loads eight characters as little endian integer.
+		///
+		inline uint64_t LoadEight(const char* data) {
+			uint64_t chunk;
+			memcpy(&chunk, data, sizeof(chunk));
+			return chunk;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseDigits-->
+		/// @brief Parses decimal digits into an unsigned long long value, eight at a time while possible.
+		/// @param[in] data The characters.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The value. It is only valid, if the number of digits is below 20, and wraps around otherwise.
+		/// @return The number of digits.
+		///
+		inline size_t ParseDigits(const char* data, size_t size, uint64_t& value) {
+			size_t i = 0;
+			while (i + 8 <= size) {
+				uint64_t chunk = LoadEight(data + i);
+				if (!IsEightDigits(chunk)) break;
+				value = value * 100000000 + ParseEightDigits(chunk);
+				i += 8;
+			}
+			for (; i < size && IsDigit(data[i]); ++i) value = value * 10 + static_cast<uint64_t>(data[i] - '0');
+			return i;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseUInt-->
+		/// @brief Parses an unsigned long long value from the start of the characters, like std::from_chars.
+		/// @param[in] data The characters. They don't need to be null-terminated. Neither whitespaces nor signs are skipped.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and ParseError::None, ParseError::Invalid or ParseError::OutOfRange.
+		///
+		inline ParseResult ParseUInt(const char* data, size_t size, uint64_t& value) {
+			size_t start = 0;
+			while (start < size && data[start] == '0') ++start;
+			uint64_t result = 0;
+			size_t digits = ParseDigits(data + start, size - start, result);
+			ParseResult parseResult = { start + digits, ParseError::None };
+			if (parseResult.consumed == 0) {
+				parseResult.error = ParseError::Invalid;
+				return parseResult;
+			}
+			if (digits == 20) {
+				result = 0;
+				ParseDigits(data + start, 19, result);
+				const uint64_t last = static_cast<uint64_t>(data[start + 19] - '0');
+				if (result > (UINT64_MAX - last) / 10) digits = 21;
+				else result = result * 10 + last;
+			}
+			if (digits > 20) parseResult.error = ParseError::OutOfRange;
+			else value = result;
+			return parseResult;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses an unsigned integer value from the start of the characters, like std::from_chars.
+		/// @param[in] data The characters. They don't need to be null-terminated. Neither whitespaces nor signs are skipped.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and ParseError::None, ParseError::Invalid or ParseError::OutOfRange.
+		///
+		inline ParseResult ParseUInt(const char* data, size_t size, uint32_t& value) {
+			uint64_t result;
+			ParseResult parseResult = ParseUInt(data, size, result);
+			if (parseResult.error != ParseError::None) return parseResult;
+			if (result > UINT32_MAX) parseResult.error = ParseError::OutOfRange;
+			else value = static_cast<uint32_t>(result);
+			return parseResult;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseInt-->
+		/// @brief Parses a signed long long value from the start of the characters, like std::from_chars.
+		/// @param[in] data The characters. They don't need to be null-terminated. Whitespaces and a plus sign are not skipped.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and ParseError::None, ParseError::Invalid or ParseError::OutOfRange.
+		///
+		inline ParseResult ParseInt(const char* data, size_t size, int64_t& value) {
+			const bool negative = size > 0 && data[0] == '-';
+			const size_t sign = negative ? 1 : 0;
+			uint64_t magnitude;
+			ParseResult parseResult = ParseUInt(data + sign, size - sign, magnitude);
+			if (parseResult.error == ParseError::Invalid) {
+				parseResult.consumed = 0;
+				return parseResult;
+			}
+			parseResult.consumed += sign;
+			if (parseResult.error != ParseError::None) return parseResult;
+			if (magnitude > static_cast<uint64_t>(INT64_MAX) + sign) parseResult.error = ParseError::OutOfRange;
+			else value = negative ? static_cast<int64_t>(0 - magnitude) : static_cast<int64_t>(magnitude);
+			return parseResult;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses a signed integer value from the start of the characters, like std::from_chars.
+		/// @param[in] data The characters. They don't need to be null-terminated. Whitespaces and a plus sign are not skipped.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and ParseError::None, ParseError::Invalid or ParseError::OutOfRange.
+		///
+		inline ParseResult ParseInt(const char* data, size_t size, int32_t& value) {
+			int64_t result;
+			ParseResult parseResult = ParseInt(data, size, result);
+			if (parseResult.error != ParseError::None) return parseResult;
+			if (result < INT32_MIN || result > INT32_MAX) parseResult.error = ParseError::OutOfRange;
+			else value = static_cast<int32_t>(result);
+			return parseResult;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Multiply128-->
+		/// @brief Multiplies two unsigned long long values into 128 bits.
+		/// @param[in] lhs The first factor.
+		/// @param[in] rhs The second factor.
+		/// @param[out] high The upper 64 bits of the product.
+		/// @return The lower 64 bits of the product.
+		///
+		inline uint64_t Multiply128(uint64_t lhs, uint64_t rhs, uint64_t& high) {
+#if defined(_MSC_VER) && defined(_M_X64)
+			return _umul128(lhs, rhs, &high);
+#elif defined(__SIZEOF_INT128__)
+			const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+			high = static_cast<uint64_t>(product >> 64);
+			return static_cast<uint64_t>(product);
+#else
+			const uint64_t a = lhs >> 32;
+			const uint64_t b = lhs & 0xFFFFFFFF;
+			const uint64_t c = rhs >> 32;
+			const uint64_t d = rhs & 0xFFFFFFFF;
+			const uint64_t bd = b * d;
+			const uint64_t middle = (bd >> 32) + (a * d & 0xFFFFFFFF) + (b * c & 0xFFFFFFFF);
+			high = a * c + (a * d >> 32) + (b * c >> 32) + (middle >> 32);
+			return (middle << 32) | (bd & 0xFFFFFFFF);
+#endif
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ComputeDouble-->
+		/// @brief Computes the double value closest to w * 10^q with the Eisel-Lemire algorithm.
+		/// @param[in] q The decimal exponent.
+		/// @param[in] w The decimal significand.
+		/// @return The significand and the biased exponent of the double value. The exponent is -1, if the 128-bit product is too inexact to decide the rounding.
+		/// @note w is normalized and multiplied with the 128-bit approximation of 5^q. Its upper 54 bits are the rounded significand in almost all cases.
+		///
+		inline BinaryDouble ComputeDouble(int64_t q, uint64_t w) {
+			BinaryDouble result = { 0, 0 };
+			if (w == 0 || q < kSmallestPowerOfFive) return result;
+			if (q > kLargestPowerOfFive) {
+				result.exponent = 0x7FF;
+				return result;
+			}
+			const uint32_t high = static_cast<uint32_t>(w >> 32);
+			const int32_t leadingZeros = high != 0 ? 31 - static_cast<int32_t>(Simd::CountLeadingBit(high)) : 63 - static_cast<int32_t>(Simd::CountLeadingBit(static_cast<uint32_t>(w)));
+			w <<= leadingZeros;
+
+			const size_t index = 2 * static_cast<size_t>(q - kSmallestPowerOfFive);
+			uint64_t upper;
+			uint64_t lower = Multiply128(w, kPowersOfFive[index], upper);
+			if ((upper & 0x1FF) == 0x1FF) {
+				uint64_t secondUpper;
+				Multiply128(w, kPowersOfFive[index + 1], secondUpper);
+				lower += secondUpper;
+				if (secondUpper > lower) ++upper;
+			}
+			if (lower == UINT64_MAX && (q < -27 || q > 55)) {
+				result.exponent = -1;
+				return result;
+			}
+
+			const int32_t upperBit = static_cast<int32_t>(upper >> 63);
+			uint64_t significand = upper >> (upperBit + 9);
+			int32_t exponent = static_cast<int32_t>(((152170 + 65536) * q) >> 16) + 63 + upperBit - leadingZeros + 1023;
+			if (exponent <= 0) {
+				if (-exponent + 1 >= 64) return result;
+				significand >>= -exponent + 1;
+				significand += significand & 1;
+				significand >>= 1;
+				result.significand = significand & ((1ull << 52) - 1);
+				result.exponent = significand < (1ull << 52) ? 0 : 1;
+				return result;
+			}
+			if (lower <= 1 && q >= -4 && q <= 23 && (significand & 3) == 1 && (significand << (upperBit + 9)) == upper) significand &= ~1ull;
+			significand += significand & 1;
+			significand >>= 1;
+			if (significand >= (2ull << 52)) {
+				significand = 1ull << 52;
+				++exponent;
+			}
+			result.significand = significand & ((1ull << 52) - 1);
+			result.exponent = exponent >= 0x7FF ? 0x7FF : exponent;
+			if (exponent >= 0x7FF) result.significand = 0;
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseDoubleFallback-->
+		/// @brief Parses a double value with strtod after replacing the decimal point with the one of the current locale.
+		/// @param[in] data The characters of the number, already checked by ParseDouble(const char*, size_t, double&).
+		/// @param[in] size The number of characters.
+		/// @return The parsed value.
+		///
+		inline double ParseDoubleFallback(const char* data, size_t size) {
+			char buffer[256];
+			char* copy = size < sizeof(buffer) ? buffer : static_cast<char*>(malloc(size + 1));
+			const char decimalPoint = *localeconv()->decimal_point;
+			for (size_t i = 0; i < size; ++i) copy[i] = data[i] == '.' ? decimalPoint : data[i];
+			copy[size] = '\0';
+			double value = strtod(copy, nullptr);
+			if (copy != buffer) free(copy);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ParseDouble-->
+		/// @brief Parses a double value from the start of the characters, like std::from_chars with std::chars_format::general.
+		/// @param[in] data The characters. They don't need to be null-terminated. Whitespaces and a plus sign are not skipped.
+		/// \n Accepted are [-]digits[.digits][(e|E)[+|-]digits], [-].digits[...], [-]inf, [-]infinity and [-]nan in any case. The decimal point is always '.'.
+		/// @param[in] size The number of characters.
+		/// @param[out] value The parsed value, correctly rounded. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and ParseError::None, ParseError::Invalid or ParseError::OutOfRange, if the value is too large for a double.
+		/// @note Up to 19 significant digits are parsed eight at a time, values with up to 15 digits and small exponents are computed with one
+		/// \n multiplication or division and all others with the Eisel-Lemire algorithm. strtod is only called for the rare inexact cases.
+		///
+		inline ParseResult ParseDouble(const char* data, size_t size, double& value) {
+			ParseResult parseResult = { 0, ParseError::Invalid };
+			size_t i = 0;
+			const bool negative = size > 0 && data[0] == '-';
+			if (negative) ++i;
+
+			if (i < size && !IsDigit(data[i]) && data[i] != '.') {
+				const char* word = data + i;
+				size_t remaining = size - i;
+				double special;
+				size_t length = 0;
+				if (remaining >= 3 && (word[0] | 0x20) == 'n' && (word[1] | 0x20) == 'a' && (word[2] | 0x20) == 'n') {
+					special = std::numeric_limits<double>::quiet_NaN();
+					length = 3;
+				} else if (remaining >= 3 && (word[0] | 0x20) == 'i' && (word[1] | 0x20) == 'n' && (word[2] | 0x20) == 'f') {
+					special = std::numeric_limits<double>::infinity();
+					length = 3;
+					const char* const rest = "inity";
+					while (length < 8 && length < remaining && (word[length] | 0x20) == rest[length - 3]) ++length;
+					if (length != 8) length = 3;
+				} else {
+					return parseResult;
+				}
+				value = negative ? -special : special;
+				parseResult.consumed = i + length;
+				parseResult.error = ParseError::None;
+				return parseResult;
+			}
+
+			const size_t integralStart = i;
+			uint64_t significand = 0;
+			i += ParseDigits(data + i, size - i, significand);
+			const size_t integralDigits = i - integralStart;
+			size_t fractionDigits = 0;
+			size_t fractionStart = i;
+			if (i < size && data[i] == '.') {
+				fractionStart = ++i;
+				i += ParseDigits(data + i, size - i, significand);
+				fractionDigits = i - fractionStart;
+			}
+			if (integralDigits + fractionDigits == 0) return parseResult;
+
+			int64_t exponent = -static_cast<int64_t>(fractionDigits);
+			if (i < size && (data[i] | 0x20) == 'e') {
+				size_t e = i + 1;
+				const bool negativeExponent = e < size && data[e] == '-';
+				if (e < size && (data[e] == '-' || data[e] == '+')) ++e;
+				if (e < size && IsDigit(data[e])) {
+					int64_t explicitExponent = 0;
+					for (; e < size && IsDigit(data[e]); ++e) {
+						if (explicitExponent < 0x10000000) explicitExponent = explicitExponent * 10 + (data[e] - '0');
+					}
+					exponent += negativeExponent ? -explicitExponent : explicitExponent;
+					i = e;
+				}
+			}
+			parseResult.consumed = i;
+			parseResult.error = ParseError::None;
+
+			bool truncated = false;
+			if (integralDigits + fractionDigits > 19) {
+				size_t leadingZeros = 0;
+				for (size_t z = integralStart; z < i && (data[z] == '0' || data[z] == '.'); ++z) leadingZeros += data[z] == '0' ? 1 : 0;
+				if (integralDigits + fractionDigits - leadingZeros > 19) {
+					truncated = true;
+					significand = 0;
+					exponent += static_cast<int64_t>(fractionDigits);
+					size_t significant = 0;
+					for (size_t d = integralStart; d < integralStart + integralDigits; ++d) {
+						if (significant < 19) {
+							significand = significand * 10 + static_cast<uint64_t>(data[d] - '0');
+							if (significand != 0) ++significant;
+						} else {
+							++exponent;
+						}
+					}
+					for (size_t d = fractionStart; d < fractionStart + fractionDigits && significant < 19; ++d) {
+						significand = significand * 10 + static_cast<uint64_t>(data[d] - '0');
+						if (significand != 0) ++significant;
+						--exponent;
+					}
+				}
+			}
+
+			double result;
+			if (!truncated && exponent >= -22 && exponent <= 22 && significand <= (1ull << 53)) {
+				result = static_cast<double>(significand);
+				result = exponent < 0 ? result / kExactPowersOfTen[-exponent] : result * kExactPowersOfTen[exponent];
+			} else {
+				BinaryDouble binary = ComputeDouble(exponent, significand);
+				if (truncated && binary.exponent >= 0) {
+					BinaryDouble next = ComputeDouble(exponent, significand + 1);
+					if (next.exponent != binary.exponent || next.significand != binary.significand) binary.exponent = -1;
+				}
+				if (binary.exponent < 0) {
+					result = ParseDoubleFallback(data + integralStart, i - integralStart);
+				} else {
+					uint64_t bits = (static_cast<uint64_t>(binary.exponent) << 52) | binary.significand;
+					memcpy(&result, &bits, sizeof(result));
+				}
+			}
+			if (result - result != 0.0) {
+				parseResult.error = ParseError::OutOfRange;
+				return parseResult;
+			}
+			value = negative ? -result : result;
+			return parseResult;
+		}
+	}
+}
@@ -0,0 +1,521 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <inttypes.h>
+#include <emmintrin.h>
+#include <nmmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#include "PowerCharSet.h"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define POWER_TARGET_SSSE3									///< Enables SSSE3 code generation for a function. MSVC always allows the intrinsics.
+#define POWER_TARGET_PCLMUL									///< Enables PCLMULQDQ code generation for a function. MSVC always allows the intrinsics.
+#define POWER_TARGET_SSE42									///< Enables SSE4.2 code generation for a function. MSVC always allows the intrinsics.
+#else
+#include <cpuid.h>
+#define POWER_TARGET_SSSE3		__attribute__((target("ssse3")))	///< Enables SSSE3 code generation for a function.
+#define POWER_TARGET_PCLMUL		__attribute__((target("pclmul")))	///< Enables PCLMULQDQ code generation for a function.
+#define POWER_TARGET_SSE42		__attribute__((target("sse4.2")))	///< Enables SSE4.2 code generation for a function.
+#endif
+
+
+namespace Power {
+	namespace Simd {
+		/// @brief The instruction set extensions of the executing processor which are used by the vectorized code paths.
+		/// @brief SSE2 is part of the x64 baseline and the default /arch of 32-bit MSVC, so it is not listed.
+		///
+		struct CpuFeatures {
+			bool ssse3;					///< PSHUFB byte shuffles.
+			bool pclmul;				///< PCLMULQDQ carry-less multiplication.
+			bool sse42;					///< SSE4.2, e.g. the CRC32 instruction.
+			size_t lastLevelCacheSize;	///< Size of the largest data cache in bytes.
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CpuId-->
+		/// @brief Executes the CPUID instruction.
+		/// @param[in] leaf The leaf to be queried (EAX).
+		/// @param[in] subLeaf The sub-leaf to be queried (ECX).
+		/// @param[out] info The returned registers EAX, EBX, ECX and EDX.
+		///
+		inline void CpuId(uint32_t leaf, uint32_t subLeaf, uint32_t* info) {
+#ifdef _MSC_VER
+			__cpuidex(reinterpret_cast<int*>(info), static_cast<int>(leaf), static_cast<int>(subLeaf));
+#else
+			__cpuid_count(leaf, subLeaf, info[0], info[1], info[2], info[3]);
+#endif
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--DetectCpuFeatures-->
+		/// @brief Queries the processor for its supported instruction set extensions.
+		/// @return The supported instruction set extensions.
+		/// @note Use GetCpuFeatures() instead, which caches the result.
+		///
+		inline CpuFeatures DetectCpuFeatures() {
+			CpuFeatures features = { false, false, false, 8 * 1024 * 1024 };
+			uint32_t info[4];
+			CpuId(0, 0, info);
+			uint32_t maxLeaf = info[0];
+			if (maxLeaf < 1) return features;
+			CpuId(1, 0, info);
+			features.ssse3 = (info[2] & (1 << 9)) != 0;
+			features.pclmul = (info[2] & (1 << 1)) != 0;
+			features.sse42 = (info[2] & (1 << 20)) != 0;
+			// Intel reports the caches in leaf 4, AMD in leaf 0x8000001D. Both use the same layout.
+			uint32_t cacheLeaf = 4;
+			if (maxLeaf < 4) cacheLeaf = 0;
+			CpuId(0x80000000, 0, info);
+			if (info[0] >= 0x8000001D) {
+				CpuId(0x8000001D, 0, info);
+				if ((info[0] & 0x1F) != 0) cacheLeaf = 0x8000001D;
+			}
+			if (cacheLeaf == 0) return features;
+			size_t largest = 0;
+			for (uint32_t subLeaf = 0; subLeaf < 16; ++subLeaf) {
+				CpuId(cacheLeaf, subLeaf, info);
+				uint32_t type = info[0] & 0x1F;
+				if (type == 0) break;
+				if (type == 2) continue;
+				size_t ways = (info[1] >> 22) + 1;
+				size_t partitions = ((info[1] >> 12) & 0x3FF) + 1;
+				size_t lineSize = (info[1] & 0xFFF) + 1;
+				size_t sets = static_cast<size_t>(info[2]) + 1;
+				size_t cacheSize = ways * partitions * lineSize * sets;
+				if (cacheSize > largest) largest = cacheSize;
+			}
+			if (largest != 0) features.lastLevelCacheSize = largest;
+			return features;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--GetCpuFeatures-->
+		/// @brief Gets the supported instruction set extensions of the executing processor.
+		/// @return The supported instruction set extensions. The processor is only queried on the first call.
+		///
+		inline const CpuFeatures& GetCpuFeatures() {
+			static const CpuFeatures features = DetectCpuFeatures();
+			return features;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountTrailingZeros-->
+		/// @brief Counts the trailing zero bits of a mask.
+		/// @param[in] mask The mask to be scanned. Must not be 0.
+		/// @return The index of the lowest set bit.
+		///
+		inline uint32_t CountTrailingZeros(uint32_t mask) {
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return static_cast<uint32_t>(index);
+#else
+			return static_cast<uint32_t>(__builtin_ctz(mask));
+#endif
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PopCount-->
+		/// @brief Counts the set bits of a mask without requiring the POPCNT instruction.
+		/// @param[in] mask The mask to be counted.
+		/// @return The number of set bits.
+		///
+		inline uint32_t PopCount(uint32_t mask) {
+			mask = mask - ((mask >> 1) & 0x55555555);
+			mask = (mask & 0x33333333) + ((mask >> 2) & 0x33333333);
+			return (((mask + (mask >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountLeadingBit-->
+		/// @brief Finds the highest set bit of a mask.
+		/// @param[in] mask The mask to be scanned. Must not be 0.
+		/// @return The index of the highest set bit.
+		///
+		inline uint32_t CountLeadingBit(uint32_t mask) {
+#ifdef _MSC_VER
+			unsigned long index;
+			_BitScanReverse(&index, mask);
+			return static_cast<uint32_t>(index);
+#else
+			return static_cast<uint32_t>(31 - __builtin_clz(mask));
+#endif
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountTrailingZeros64-->
+		/// @brief Counts the trailing zero bits of a 64-bit mask.
+		/// @param[in] mask The mask to be scanned. Must not be 0.
+		/// @return The index of the lowest set bit.
+		///
+		inline uint32_t CountTrailingZeros64(uint64_t mask) {
+			uint32_t low = static_cast<uint32_t>(mask);
+			return low != 0 ? CountTrailingZeros(low) : 32 + CountTrailingZeros(static_cast<uint32_t>(mask >> 32));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--StreamCopy-->
+		/// @brief Copies bytes with non-temporal stores, which write around the caches instead of evicting their contents.
+		/// @param[out] destination The destination of the bytes. Must not overlap the source.
+		/// @param[in] source The bytes to be copied.
+		/// @param[in] size The number of bytes to be copied.
+		/// @note Only worth it if the destination is larger than the last level cache and won't be read again soon.
+		///
+		inline void StreamCopy(char* destination, const char* source, size_t size) {
+			size_t head = (16 - (reinterpret_cast<uintptr_t>(destination) & 15)) & 15;
+			if (head > size) head = size;
+			memcpy(destination, source, head);
+			size_t i = head;
+			for (; i + 64 <= size; i += 64) {
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 16));
+				__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 32));
+				__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 48));
+				_mm_stream_si128(reinterpret_cast<__m128i*>(destination + i), a);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(destination + i + 16), b);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(destination + i + 32), c);
+				_mm_stream_si128(reinterpret_cast<__m128i*>(destination + i + 48), d);
+			}
+			_mm_sfence();
+			memcpy(destination + i, source + i, size - i);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FillPattern-->
+		/// @brief Fills the destination with repetitions of a pattern, cutting off the last repetition at the end.
+		/// @param[out] destination The bytes to be filled. Must not overlap the pattern.
+		/// @param[in] size The number of bytes to be filled.
+		/// @param[in] pattern The pattern to fill with.
+		/// @param[in] patternSize The size of the pattern. Must not be 0.
+		/// @note The filled part of the destination is copied onto the rest with doubling sizes (1, 2, 4, ... repetitions), so a short pattern costs
+		/// \n only a logarithmic number of copies. The doubling stops at a cache-sized block, which is then repeated, with non-temporal stores if
+		/// \n the destination is larger than the last level cache.
+		///
+		inline void FillPattern(char* destination, size_t size, const char* pattern, size_t patternSize) {
+			if (patternSize >= size) {
+				memcpy(destination, pattern, size);
+				return;
+			}
+			memcpy(destination, pattern, patternSize);
+			const size_t blockLimit = 64 * 1024;
+			size_t filled = patternSize;
+			while (filled < size && filled < blockLimit) {
+				size_t count = size - filled < filled ? size - filled : filled;
+				memcpy(destination + filled, destination, count);
+				filled += count;
+			}
+			const size_t block = filled;
+			const bool stream = size > GetCpuFeatures().lastLevelCacheSize;
+			while (filled < size) {
+				size_t count = size - filled < block ? size - filled : block;
+				if (stream) StreamCopy(destination + filled, destination, count);
+				else memcpy(destination + filled, destination, count);
+				filled += count;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TranslateBytes-->
+		/// @brief Translates 16 bytes per iteration by looking up the changed rows of the table with PSHUFB.
+		/// @param[in] table The 256-entry translation table.
+		/// @param[in] rows The high nibbles of the rows which differ from the identity.
+		/// @param[in] rowCount The number of rows in rows.
+		/// @param[in] source The bytes to be translated.
+		/// @param[out] destination The translated bytes.
+		/// @param[in] size The number of bytes to be translated. Must be a multiple of 16.
+		///
+		POWER_TARGET_SSSE3 inline void TranslateBytesSsse3(const uint8_t* table, const uint8_t* rows, size_t rowCount, const char* source, char* destination, size_t size) {
+			__m128i lookups[16];
+			__m128i highNibbles[16];
+			for (size_t r = 0; r < rowCount; ++r) {
+				lookups[r] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + rows[r] * 16));
+				highNibbles[r] = _mm_set1_epi8(static_cast<char>(rows[r]));
+			}
+			const __m128i lowMask = _mm_set1_epi8(0x0F);
+			for (size_t i = 0; i < size; i += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+				__m128i low = _mm_and_si128(bytes, lowMask);
+				__m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask);
+				__m128i result = bytes;
+				for (size_t r = 0; r < rowCount; ++r) {
+					__m128i inRow = _mm_cmpeq_epi8(high, highNibbles[r]);
+					__m128i mapped = _mm_shuffle_epi8(lookups[r], low);
+					result = _mm_or_si128(_mm_andnot_si128(inRow, result), _mm_and_si128(inRow, mapped));
+				}
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), result);
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Maps every byte of the source through a 256-entry table and writes the result to the destination.
+		/// @param[in] table The 256-entry translation table.
+		/// @param[in] source The bytes to be translated.
+		/// @param[out] destination The translated bytes. May be equal to source but must not overlap it otherwise.
+		/// @param[in] size The number of bytes to be translated.
+		/// @note Each 16-entry row of the table (all bytes sharing a high nibble) that differs from the identity costs one PSHUFB lookup per 16 bytes.
+		/// \n Tables with up to four such rows are translated with SSSE3, all others with an unrolled scalar loop which is faster beyond that point.
+		///
+		inline void TranslateBytes(const uint8_t* table, const char* source, char* destination, size_t size) {
+			uint8_t rows[16];
+			size_t rowCount = 0;
+			for (uint32_t r = 0; r < 16; ++r) {
+				for (uint32_t i = 0; i < 16; ++i) {
+					if (table[r * 16 + i] != r * 16 + i) {
+						rows[rowCount++] = static_cast<uint8_t>(r);
+						break;
+					}
+				}
+			}
+			if (rowCount == 0) {
+				if (source != destination) memcpy(destination, source, size);
+				return;
+			}
+			size_t i = 0;
+			if (rowCount <= 4 && size >= 16 && GetCpuFeatures().ssse3) {
+				i = size & ~static_cast<size_t>(15);
+				TranslateBytesSsse3(table, rows, rowCount, source, destination, i);
+			}
+			const uint8_t* src = reinterpret_cast<const uint8_t*>(source);
+			for (; i + 4 <= size; i += 4) {
+				uint8_t b0 = table[src[i]], b1 = table[src[i + 1]], b2 = table[src[i + 2]], b3 = table[src[i + 3]];
+				destination[i] = static_cast<char>(b0);
+				destination[i + 1] = static_cast<char>(b1);
+				destination[i + 2] = static_cast<char>(b2);
+				destination[i + 3] = static_cast<char>(b3);
+			}
+			for (; i < size; ++i) destination[i] = static_cast<char>(table[src[i]]);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MatchCharSet-->
+		/// @brief Tests 16 bytes for membership in a Power::CharSet with two PSHUFB nibble lookups.
+		/// @param[in] bytes The bytes to be tested.
+		/// @param[in] low The low table of the Power::CharSet (see CharSet::LowTable()).
+		/// @param[in] high The high table of the Power::CharSet (see CharSet::HighTable()).
+		/// @return A 16-bit mask with bit i set, if byte i is part of the Power::CharSet.
+		///
+		POWER_TARGET_SSSE3 inline uint32_t MatchCharSet(__m128i bytes, __m128i low, __m128i high) {
+			const __m128i lowMask = _mm_set1_epi8(0x0F);
+			const __m128i bitSelect = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+			// PSHUFB zeroes lanes whose index has bit 7 set, so each table only answers for its own half of the byte range.
+			__m128i rows = _mm_or_si128(_mm_shuffle_epi8(low, bytes), _mm_shuffle_epi8(high, _mm_xor_si128(bytes, _mm_set1_epi8(-128))));
+			__m128i bits = _mm_shuffle_epi8(bitSelect, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowMask));
+			__m128i miss = _mm_cmpeq_epi8(_mm_and_si128(rows, bits), _mm_setzero_si128());
+			return static_cast<uint32_t>(~_mm_movemask_epi8(miss)) & 0xFFFF;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SkipCharSet-->
+		/// @brief Finds the first byte which is not part of a Power::CharSet, 16 bytes per iteration.
+		/// @param[in] set The Power::CharSet with the bytes to be skipped.
+		/// @param[in] data The bytes to be scanned.
+		/// @param[in] size The number of bytes to be scanned.
+		/// @return The index of the first byte which is not part of the Power::CharSet or, if there is none, the number of whole 16-byte blocks scanned times 16.
+		///
+		POWER_TARGET_SSSE3 inline size_t SkipCharSetSsse3(const CharSet& set, const char* data, size_t size) {
+			const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.LowTable()));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.HighTable()));
+			size_t i = 0;
+			for (; i + 16 <= size; i += 16) {
+				uint32_t others = ~MatchCharSet(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)), low, high) & 0xFFFF;
+				if (others != 0) return i + CountTrailingZeros(others);
+			}
+			return i;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Finds the first byte which is not part of a Power::CharSet.
+		/// @param[in] set The Power::CharSet with the bytes to be skipped.
+		/// @param[in] data The bytes to be scanned.
+		/// @param[in] size The number of bytes to be scanned.
+		/// @return The index of the first byte which is not part of the Power::CharSet or size, if all bytes are.
+		///
+		inline size_t SkipCharSet(const CharSet& set, const char* data, size_t size) {
+			size_t i = 0;
+			// Trimmed text usually stops after a few bytes, which the scalar loop settles before a vector load would pay off.
+			for (; i < size && i < 16; ++i) {
+				if (!set.Contains(data[i])) return i;
+			}
+			if (size - i >= 16 && GetCpuFeatures().ssse3) {
+				i += SkipCharSetSsse3(set, data + i, size - i);
+			}
+			for (; i < size; ++i) {
+				if (!set.Contains(data[i])) return i;
+			}
+			return size;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SkipCharSetBackward-->
+		/// @brief Finds the last byte which is not part of a Power::CharSet, 16 bytes per iteration.
+		/// @param[in] set The Power::CharSet with the bytes to be skipped.
+		/// @param[in] data The bytes to be scanned.
+		/// @param[in] size The number of bytes to be scanned.
+		/// @return The index behind the last byte which is not part of the Power::CharSet or, if there is none, the number of bytes left in front of the scanned 16-byte blocks.
+		///
+		POWER_TARGET_SSSE3 inline size_t SkipCharSetBackwardSsse3(const CharSet& set, const char* data, size_t size) {
+			const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.LowTable()));
+			const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.HighTable()));
+			size_t end = size;
+			for (; end >= 16; end -= 16) {
+				uint32_t others = ~MatchCharSet(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + end - 16)), low, high) & 0xFFFF;
+				if (others != 0) return end - 16 + CountLeadingBit(others) + 1;
+			}
+			return end;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Finds the last byte which is not part of a Power::CharSet.
+		/// @param[in] set The Power::CharSet with the bytes to be skipped.
+		/// @param[in] data The bytes to be scanned.
+		/// @param[in] size The number of bytes to be scanned.
+		/// @return The index behind the last byte which is not part of the Power::CharSet or 0, if all bytes are.
+		///
+		inline size_t SkipCharSetBackward(const CharSet& set, const char* data, size_t size) {
+			size_t end = size;
+			for (; end > 0 && size - end < 16; --end) {
+				if (!set.Contains(data[end - 1])) return end;
+			}
+			if (end >= 16 && GetCpuFeatures().ssse3) {
+				end = SkipCharSetBackwardSsse3(set, data, end);
+			}
+			for (; end > 0; --end) {
+				if (!set.Contains(data[end - 1])) return end;
+			}
+			return 0;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MatchChar-->
+		/// @brief Compares 16 bytes to a character.
+		/// @param[in] data The 16 bytes to be compared.
+		/// @param[in] c The character.
+		/// @return A 16-bit mask with bit i set, if byte i equals the character.
+		///
+		inline uint32_t MatchChar(const char* data, const char c) {
+			return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), _mm_set1_epi8(c))));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FindText-->
+		/// @brief Finds the first occurance of a sequence of characters, testing 16 candidate positions per iteration.
+		/// @param[in] data The bytes to be scanned.
+		/// @param[in] size The number of bytes to be scanned.
+		/// @param[in] text The characters to be found. Must not be empty.
+		/// @param[in] textSize The number of characters to be found.
+		/// @return The index of the first occurance or size, if there is none.
+		/// @note Only positions whose first and last byte match the text are compared with memcmp.
+		///
+		inline size_t FindText(const char* data, size_t size, const char* text, size_t textSize) {
+			if (textSize > size) return size;
+			const size_t positions = size - textSize + 1;
+			const __m128i firstChar = _mm_set1_epi8(text[0]);
+			const __m128i lastChar = _mm_set1_epi8(text[textSize - 1]);
+			size_t i = 0;
+			for (; i + 16 <= positions; i += 16) {
+				__m128i firstBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				__m128i lastBytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + textSize - 1));
+				uint32_t candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(firstBytes, firstChar), _mm_cmpeq_epi8(lastBytes, lastChar))));
+				while (candidates != 0) {
+					size_t index = i + CountTrailingZeros(candidates);
+					if (memcmp(data + index + 1, text + 1, textSize - 1) == 0) return index;
+					candidates &= candidates - 1;
+				}
+			}
+			for (; i < positions; ++i) {
+				if (data[i] == text[0] && memcmp(data + i + 1, text + 1, textSize - 1) == 0) return i;
+			}
+			return size;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--MatchChar64-->
+		/// @brief Compares 64 bytes to a character.
+		/// @param[in] data The 64 bytes to be compared.
+		/// @param[in] c The character.
+		/// @return A 64-bit mask with bit i set, if byte i equals the character.
+		///
+		inline uint64_t MatchChar64(const char* data, const char c) {
+			return static_cast<uint64_t>(MatchChar(data, c)) | static_cast<uint64_t>(MatchChar(data + 16, c)) << 16
+				| static_cast<uint64_t>(MatchChar(data + 32, c)) << 32 | static_cast<uint64_t>(MatchChar(data + 48, c)) << 48;
+		}
+
+#if defined(_M_X64) || defined(__x86_64__)
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PrefixXorPclmul-->
+		/// @brief Computes the prefix xor of a mask with one carry-less multiplication by all ones.
+		/// @param[in] mask The mask.
+		/// @return A mask with bit i set, if an odd number of bits from 0 to i is set in the mask.
+		///
+		POWER_TARGET_PCLMUL inline uint64_t PrefixXorPclmul(uint64_t mask) {
+			__m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(mask)), _mm_set1_epi8(-1), 0);
+			return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+		}
+#endif
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PrefixXor-->
+		/// @brief Computes the prefix xor of a mask, e.g. to turn the positions of quotes into the ranges between them.
+		/// @param[in] mask The mask.
+		/// @param[in] pclmul Use PCLMULQDQ (see CpuFeatures::pclmul). It is only used in 64-bit builds.
+		/// @return A mask with bit i set, if an odd number of bits from 0 to i is set in the mask.
+		///
+		inline uint64_t PrefixXor(uint64_t mask, bool pclmul) {
+#if defined(_M_X64) || defined(__x86_64__)
+			if (pclmul) return PrefixXorPclmul(mask);
+#else
+			(void)pclmul;
+#endif
+			mask ^= mask << 1;
+			mask ^= mask << 2;
+			mask ^= mask << 4;
+			mask ^= mask << 8;
+			mask ^= mask << 16;
+			mask ^= mask << 32;
+			return mask;
+		}
+
+		/// @brief The lookup table of the CRC-32C polynomial for processors without SSE4.2.
+		///
+		struct Crc32cTable {
+			uint32_t entries[256];
+
+			Crc32cTable() {
+				for (uint32_t i = 0; i < 256; ++i) {
+					uint32_t crc = i;
+					for (int bit = 0; bit < 8; ++bit) crc = (crc >> 1) ^ (0x82F63B78 & (0 - (crc & 1)));
+					entries[i] = crc;
+				}
+			}
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Crc32cSse42-->
+		/// @brief Continues a CRC-32C checksum with the CRC32 instruction, 8 bytes at a time in 64-bit builds.
+		/// @param[in] crc The checksum of the preceding bytes or 0.
+		/// @param[in] data The bytes to be added.
+		/// @param[in] size The number of bytes.
+		/// @return The checksum including the bytes.
+		///
+		POWER_TARGET_SSE42 inline uint32_t Crc32cSse42(uint32_t crc, const char* data, size_t size) {
+			crc = ~crc;
+#if defined(_M_X64) || defined(__x86_64__)
+			uint64_t wideCrc = crc;
+			for (; size >= 8; size -= 8, data += 8) {
+				uint64_t value;
+				memcpy(&value, data, 8);
+				wideCrc = _mm_crc32_u64(wideCrc, value);
+			}
+			crc = static_cast<uint32_t>(wideCrc);
+#endif
+			for (; size >= 4; size -= 4, data += 4) {
+				uint32_t value;
+				memcpy(&value, data, 4);
+				crc = _mm_crc32_u32(crc, value);
+			}
+			for (; size > 0; --size, ++data) crc = _mm_crc32_u8(crc, static_cast<uint8_t>(*data));
+			return ~crc;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Crc32c-->
+		/// @brief Continues a CRC-32C (Castagnoli) checksum, e.g. to detect corrupted files.
+		/// @param[in] crc The checksum of the preceding bytes or 0.
+		/// @param[in] data The bytes to be added.
+		/// @param[in] size The number of bytes.
+		/// @return The checksum including the bytes.
+		/// @note The CRC32 instruction of SSE4.2 is used, if it is supported (see CpuFeatures::sse42). Otherwise a lookup table is used.
+		///
+		inline uint32_t Crc32c(uint32_t crc, const char* data, size_t size) {
+			if (GetCpuFeatures().sse42) return Crc32cSse42(crc, data, size);
+			static const Crc32cTable table;
+			crc = ~crc;
+			for (size_t i = 0; i < size; ++i) crc = table.entries[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+			return ~crc;
+		}
+	}
+}
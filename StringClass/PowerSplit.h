@@ -0,0 +1,334 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+
+#include "PowerCharSet.h"
+#include "PowerSimd.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief Options of Split. They can be combined with the bitwise or operator.
+	///
+	enum class SplitOptions : uint32_t {
+		None = 0,				///< Returns every part as it is.
+		RemoveEmpty = 1,		///< Skips empty parts. With Trim, parts which only contain whitespaces are skipped too.
+		Trim = 2				///< Removes leading and trailing whitespaces (see CharSet::Whitespace()) from each part.
+	};
+
+	inline SplitOptions operator|(SplitOptions lhs, SplitOptions rhs) { return static_cast<SplitOptions>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs)); }
+	inline bool operator&(SplitOptions lhs, SplitOptions rhs) { return (static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs)) != 0; }
+
+	/// @brief A lazy forward range of the parts of a sequence of characters between delimiters, returned by Split.
+	/// @brief Each part is a Power::StringView into the source, so splitting never copies or allocates.
+	/// @brief Single character and Power::CharSet delimiters are found 16 bytes at a time. The bitmask of a block is kept in the iterator,
+	/// \n so short parts within the same block don't rescan it.
+	/// @note The source must outlive the range and its iterators.
+	///
+	class SplitRange {
+	public:
+		/// @brief A forward iterator over the parts of a SplitRange.
+		///
+		class Iterator {
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef StringView value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const StringView* pointer;
+			typedef const StringView& reference;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+			/// @brief Initializes an iterator which is equal to SplitRange::end().
+			///
+			Iterator() : range_(nullptr), position_(nullptr), block_(nullptr), mask_(0), splitsLeft_(0), done_(true) {}
+
+			inline const StringView& operator*() const { return current_; }
+			inline const StringView* operator->() const { return &current_; }
+
+			inline Iterator& operator++() {
+				this->Next();
+				return *this;
+			}
+
+			inline Iterator operator++(int) {
+				Iterator previous = *this;
+				this->Next();
+				return previous;
+			}
+
+			inline bool operator==(const Iterator& other) const { return done_ == other.done_ && (done_ || current_.Data() == other.current_.Data()); }
+			inline bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+		private:
+			friend class SplitRange;
+
+			explicit Iterator(const SplitRange* range) :
+				range_(range),
+				position_(range->data_),
+				block_(range->data_),
+				mask_(0),
+				splitsLeft_(range->maxSplits_),
+				done_(false)
+			{
+				if (range_->kind_ != Kind::Text) mask_ = this->BlockMask(block_);
+				this->Next();
+			}
+
+			// Moves to the next part, which isn't skipped, or to the end.
+			inline void Next() {
+				const char* end = range_->data_ + range_->size_;
+				while (position_ != nullptr) {
+					const char* begin = position_;
+					const char* delimiter = end;
+					if (splitsLeft_ > 0) delimiter = this->FindDelimiter();
+					if (delimiter == end) position_ = nullptr;
+					else {
+						position_ = delimiter + range_->DelimiterSize();
+						--splitsLeft_;
+					}
+
+					current_ = StringView(begin, delimiter - begin);
+					if (range_->options_ & SplitOptions::Trim) current_ = current_.Trim(range_->trimSet_);
+					if (!(range_->options_ & SplitOptions::RemoveEmpty) || !current_.IsEmpty()) return;
+					// A skipped part doesn't count as a split, so the last part still contains the rest.
+					if (position_ != nullptr) ++splitsLeft_;
+				}
+				done_ = true;
+			}
+
+			inline const char* FindDelimiter() {
+				const char* end = range_->data_ + range_->size_;
+				if (range_->kind_ == Kind::Text) {
+					return position_ + Simd::FindText(position_, end - position_, range_->text_.Data(), range_->text_.Size());
+				}
+				while (mask_ == 0) {
+					block_ += 16;
+					if (block_ >= end) return end;
+					mask_ = this->BlockMask(block_);
+				}
+				const char* delimiter = block_ + Simd::CountTrailingZeros(mask_);
+				mask_ &= mask_ - 1;
+				return delimiter;
+			}
+
+			// Gets the bits of the delimiters in the 16 bytes from block, or in the remaining bytes, if there are less.
+			inline uint32_t BlockMask(const char* block) const {
+				size_t size = range_->data_ + range_->size_ - block;
+				if (size >= 16) {
+					if (range_->kind_ == Kind::Char) return Simd::MatchChar(block, range_->char_);
+					if (Simd::GetCpuFeatures().ssse3) {
+						const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(range_->set_.LowTable()));
+						const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(range_->set_.HighTable()));
+						return Simd::MatchCharSet(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block)), low, high);
+					}
+					size = 16;
+				}
+				uint32_t mask = 0;
+				for (size_t i = 0; i < size; ++i) {
+					bool match = range_->kind_ == Kind::Char ? block[i] == range_->char_ : range_->set_.Contains(block[i]);
+					mask |= static_cast<uint32_t>(match) << i;
+				}
+				return mask;
+			}
+
+			const SplitRange* range_;
+			StringView current_;
+			const char* position_;		///< The start of the next part or nullptr, if the current part is the last one.
+			const char* block_;			///< The 16-byte block described by mask_.
+			uint32_t mask_;				///< The delimiters in block_ behind the current part.
+			size_t splitsLeft_;
+			bool done_;
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a SplitRange with a single character delimiter.
+		/// @param[in] source The characters to be split.
+		/// @param[in] c The delimiter.
+		/// @param[in] options The SplitOptions.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the source.
+		///
+		SplitRange(const StringView& source, const char c, SplitOptions options, size_t maxSplits) :
+			SplitRange(source, Kind::Char, options, maxSplits)
+		{
+			char_ = c;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a SplitRange with a delimiter of multiple characters.
+		/// @param[in] source The characters to be split.
+		/// @param[in] text The delimiter. If it is empty, the source is not split.
+		/// @param[in] options The SplitOptions.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the source.
+		///
+		SplitRange(const StringView& source, const StringView& text, SplitOptions options, size_t maxSplits) :
+			SplitRange(source, Kind::Text, options, text.IsEmpty() ? 0 : maxSplits)
+		{
+			text_ = text;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a SplitRange with a set of single character delimiters.
+		/// @param[in] source The characters to be split.
+		/// @param[in] set The Power::CharSet with the delimiters.
+		/// @param[in] options The SplitOptions.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the source.
+		///
+		SplitRange(const StringView& source, const CharSet& set, SplitOptions options, size_t maxSplits) :
+			SplitRange(source, Kind::Set, options, maxSplits)
+		{
+			set_ = set;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--begin-->
+		/// @brief Finds the first part.
+		/// @return An iterator to the first part.
+		///
+		inline Iterator begin() const { return Iterator(this); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--end-->
+		/// @brief Gets the iterator behind the last part.
+		/// @return The end iterator.
+		///
+		inline Iterator end() const { return Iterator(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Count-->
+		/// @brief Counts the parts by iterating over them.
+		/// @return The number of parts.
+		///
+		inline size_t Count() const {
+			size_t count = 0;
+			for (Iterator part = this->begin(); part != this->end(); ++part) ++count;
+			return count;
+		}
+
+	private:
+		enum class Kind { Char, Text, Set };
+
+		SplitRange(const StringView& source, Kind kind, SplitOptions options, size_t maxSplits) :
+			data_(source.Data()),
+			size_(source.Size()),
+			kind_(kind),
+			options_(options),
+			maxSplits_(maxSplits),
+			char_('\0')
+		{
+			if (options_ & SplitOptions::Trim) trimSet_ = CharSet::Whitespace();
+		}
+
+		inline size_t DelimiterSize() const { return kind_ == Kind::Text ? text_.Size() : 1; }
+
+		const char* data_;
+		size_t size_;
+		Kind kind_;
+		SplitOptions options_;
+		size_t maxSplits_;
+		char char_;
+		StringView text_;
+		CharSet set_;
+		CharSet trimSet_;
+	};
+
+	/// @brief A lazy forward range of the lines of a sequence of characters, returned by Lines.
+	/// @brief Lines end with LF or CRLF. The line ending is not part of the line, and a final line ending doesn't start another empty line.
+	/// @brief Each line is a Power::StringView into the source, found with memchr, so iterating never copies or allocates.
+	/// @note The source must outlive the range and its iterators.
+	///
+	class LineRange {
+	public:
+		/// @brief A forward iterator over the lines of a LineRange.
+		///
+		class Iterator {
+		public:
+			typedef std::forward_iterator_tag iterator_category;
+			typedef StringView value_type;
+			typedef std::ptrdiff_t difference_type;
+			typedef const StringView* pointer;
+			typedef const StringView& reference;
+
+			/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+			/// @brief Initializes an iterator which is equal to LineRange::end().
+			///
+			Iterator() : position_(nullptr), end_(nullptr), done_(true) {}
+
+			inline const StringView& operator*() const { return current_; }
+			inline const StringView* operator->() const { return &current_; }
+
+			inline Iterator& operator++() {
+				this->Next();
+				return *this;
+			}
+
+			inline Iterator operator++(int) {
+				Iterator previous = *this;
+				this->Next();
+				return previous;
+			}
+
+			inline bool operator==(const Iterator& other) const { return done_ == other.done_ && (done_ || current_.Data() == other.current_.Data()); }
+			inline bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+		private:
+			friend class LineRange;
+
+			Iterator(const char* data, size_t size) : position_(data), end_(data + size), done_(false) { this->Next(); }
+
+			inline void Next() {
+				if (position_ == end_) {
+					done_ = true;
+					return;
+				}
+				const char* begin = position_;
+				const char* lineEnd = static_cast<const char*>(memchr(begin, '\n', end_ - begin));
+				if (lineEnd == nullptr) position_ = lineEnd = end_;
+				else position_ = lineEnd + 1;
+				if (lineEnd > begin && lineEnd[-1] == '\r' && lineEnd != end_) --lineEnd;
+				current_ = StringView(begin, lineEnd - begin);
+			}
+
+			StringView current_;
+			const char* position_;		///< The start of the next line.
+			const char* end_;
+			bool done_;
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a LineRange.
+		/// @param[in] source The characters to be split into lines.
+		///
+		explicit LineRange(const StringView& source) : data_(source.Data()), size_(source.Size()) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--begin-->
+		/// @brief Finds the first line.
+		/// @return An iterator to the first line.
+		///
+		inline Iterator begin() const { return Iterator(data_, size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--end-->
+		/// @brief Gets the iterator behind the last line.
+		/// @return The end iterator.
+		///
+		inline Iterator end() const { return Iterator(); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Count-->
+		/// @brief Counts the lines by iterating over them.
+		/// @return The number of lines.
+		///
+		inline size_t Count() const {
+			size_t count = 0;
+			for (Iterator line = this->begin(); line != this->end(); ++line) ++count;
+			return count;
+		}
+
+	private:
+		const char* data_;
+		size_t size_;
+	};
+
+	inline SplitRange StringView::Split(const char c, SplitOptions options, size_t maxSplits) const { return SplitRange(*this, c, options, maxSplits); }
+	inline SplitRange StringView::Split(const StringView& text, SplitOptions options, size_t maxSplits) const { return SplitRange(*this, text, options, maxSplits); }
+	inline SplitRange StringView::Split(const CharSet& set, SplitOptions options, size_t maxSplits) const { return SplitRange(*this, set, options, maxSplits); }
+	inline LineRange StringView::Lines() const { return LineRange(*this); }
+}
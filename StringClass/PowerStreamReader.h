@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+
+#include "PowerFile.h"
+#include "PowerSimd.h"
+#include "PowerString.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief Processes a file, which may be larger than the memory, in chunks of a fixed size read into one reused buffer.
+	/// @brief Besides the chunks themselves, it offers IndexOf, Count and line iteration over the whole file.
+	/// \n They keep the last characters of a chunk in front of the next one, so matches and lines crossing the chunk boundaries are found too.
+	/// @brief The memory used stays at one chunk plus the longest match or line, however large the file is.
+	/// @note Every operation reads the file from its start.
+	///
+	class StreamReader {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a new Power::StreamReader, which has no file open yet.
+		/// @param[in] chunkSize The number of characters read at once.
+		///
+		explicit StreamReader(size_t chunkSize = 256 * 1024) :
+			chunkSize_(chunkSize > 0 ? chunkSize : 1),
+			buffer_(nullptr),
+			capacity_(0),
+			options_(File::LoadOptions::Sequential),
+			open_(false)
+		{}
+
+		StreamReader(const StreamReader&) = delete;
+		StreamReader& operator=(const StreamReader&) = delete;
+
+		~StreamReader() {
+			this->Close();
+			free(buffer_);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Open-->
+		/// @brief Opens a file in binary mode. A file opened before is closed first.
+		/// @param[in] filePath The path of the file.
+		/// @param[in] options The File::LoadOptions, e.g. File::LoadOptions::Sequential | File::LoadOptions::DropCache.
+		/// @return The File::FileResult. Its size is 0.
+		///
+		inline File::FileResult Open(const String& filePath, File::LoadOptions options = File::LoadOptions::Sequential) { return this->Open(filePath.CString(), options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Opens a file in binary mode. A file opened before is closed first.
+		/// @param[in] filePath The path of the file.
+		/// @param[in] options The File::LoadOptions, e.g. File::LoadOptions::Sequential | File::LoadOptions::DropCache.
+		/// @return The File::FileResult. Its size is 0.
+		///
+		inline File::FileResult Open(const char* const filePath, File::LoadOptions options = File::LoadOptions::Sequential) {
+			this->Close();
+			uint64_t size = 0;
+			File::FileResult result = File::OpenForReading(filePath, options, file_, size);
+			open_ = result.error == File::FileError::None;
+			options_ = options;
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Close-->
+		/// @brief Closes the file. The buffer is kept for the next file.
+		///
+		inline void Close() {
+			if (open_) File::Close(file_, options_);
+			open_ = false;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsOpen-->
+		/// @brief Checks if a file is open.
+		/// @return <span style="color:#30AA00">True</span>, if a file is open.
+		/// @return <span style="color:#CC3000">False</span>, if no file is open or opening it failed.
+		///
+		inline bool IsOpen() const { return open_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ForEachChunk-->
+		/// @brief Reads the whole file one chunk after another.
+		/// @param[in] function The function called with each chunk and the offset of its first character in the file,
+		/// \n e.g. [](const Power::StringView& chunk, uint64_t offset) { ... }. The chunk is valid until the function returns.
+		/// @return The File::FileResult with the number of characters read.
+		///
+		template<typename Function>
+		File::FileResult ForEachChunk(Function function) {
+			File::FileResult total = this->Start(0);
+			if (total.error != File::FileError::None) return total;
+			while (true) {
+				File::FileResult result = File::Read(file_, buffer_, chunkSize_);
+				if (result.size > 0) function(StringView(buffer_, result.size), static_cast<uint64_t>(total.size));
+				total.size += result.size;
+				if (result.error != File::FileError::None) {
+					result.size = total.size;
+					return result;
+				}
+				if (result.size < chunkSize_) return total;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IndexOf-->
+		/// @brief Finds the first occurance of a sequence of characters in the file.
+		/// @param[in] text The characters to look for.
+		/// @param[out] index The index of the first occurance in the file. Or -1, if the characters don't occur or are empty.
+		/// @return The File::FileResult with the number of characters read. Reading stops at the first occurance.
+		///
+		inline File::FileResult IndexOf(const StringView& text, int64_t& index) {
+			index = -1;
+			return this->Scan(text, [&index](size_t position, uint64_t offset) {
+				index = static_cast<int64_t>(offset + position);
+				return false;
+			});
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Count-->
+		/// @brief Counts how many times a sequence of characters occurs in the file. Overlapping occurances are counted, like by Power::String::Count.
+		/// @param[in] text The characters to look for.
+		/// @param[out] count How many times the characters occur. 0, if they are empty.
+		/// @return The File::FileResult with the number of characters read.
+		///
+		inline File::FileResult Count(const StringView& text, uint64_t& count) {
+			count = 0;
+			return this->Scan(text, [&count](size_t, uint64_t) {
+				++count;
+				return true;
+			});
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Counts how many times a character occurs in the file.
+		/// @param[in] c The character to look for.
+		/// @param[out] count How many times the character occurs.
+		/// @return The File::FileResult with the number of characters read.
+		///
+		inline File::FileResult Count(const char c, uint64_t& count) {
+			count = 0;
+			return this->ForEachChunk([&count, c](const StringView& chunk, uint64_t) { count += chunk.Count(c); });
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ForEachLine-->
+		/// @brief Reads the file line by line. Lines end with LF or CRLF. The line ending is not part of the line.
+		/// @param[in] function The function called with each line, e.g. [](const Power::StringView& line) { ... }.
+		/// \n The line is valid until the function returns.
+		/// @return The File::FileResult with the number of characters read.
+		/// @note The unfinished line at the end of a chunk is moved in front of the next one. The buffer only grows for lines longer than a chunk.
+		///
+		template<typename Function>
+		File::FileResult ForEachLine(Function function) {
+			File::FileResult total = this->Start(0);
+			if (total.error != File::FileError::None) return total;
+			size_t kept = 0;
+			while (true) {
+				this->Reserve(kept + chunkSize_);
+				File::FileResult result = File::Read(file_, buffer_ + kept, chunkSize_);
+				total.size += result.size;
+				size_t filled = kept + result.size;
+				size_t begin = 0;
+				// The kept characters don't contain a newline, so the search starts behind them.
+				const char* lineEnd = static_cast<const char*>(memchr(buffer_ + kept, '\n', filled - kept));
+				while (lineEnd != nullptr) {
+					size_t end = lineEnd - buffer_;
+					size_t next = end + 1;
+					if (end > begin && buffer_[end - 1] == '\r') --end;
+					function(StringView(buffer_ + begin, end - begin));
+					begin = next;
+					lineEnd = static_cast<const char*>(memchr(buffer_ + begin, '\n', filled - begin));
+				}
+				if (result.error != File::FileError::None || result.size < chunkSize_) {
+					if (begin < filled) function(StringView(buffer_ + begin, filled - begin));
+					if (result.error == File::FileError::None) return total;
+					result.size = total.size;
+					return result;
+				}
+				kept = filled - begin;
+				memmove(buffer_, buffer_ + begin, kept);
+			}
+		}
+
+	private:
+		// Moves to the start of the file and makes sure the buffer holds a chunk behind the specified number of kept characters.
+		inline File::FileResult Start(size_t kept) {
+			if (!open_) return File::MakeResult(0, File::FileError::ReadFailed);
+			this->Reserve(kept + chunkSize_);
+			return File::Rewind(file_);
+		}
+
+		inline void Reserve(size_t capacity) {
+			if (capacity <= capacity_) return;
+			capacity_ = capacity;
+			buffer_ = static_cast<char*>(realloc(buffer_, capacity_));
+		}
+
+		// Finds every occurance of the text and passes its position in the buffer and the offset of the buffer in the file to found, until it returns false.
+		// The last size - 1 characters of each chunk are kept, so an occurance crossing the boundary is found in the next one.
+		// They can't contain a whole occurance themselves, so none is found twice.
+		template<typename Found>
+		File::FileResult Scan(const StringView& text, Found found) {
+			const size_t overlap = text.Size() > 0 ? text.Size() - 1 : 0;
+			File::FileResult total = this->Start(overlap);
+			if (total.error != File::FileError::None || text.IsEmpty()) return total;
+			size_t kept = 0;
+			uint64_t offset = 0;
+			while (true) {
+				File::FileResult result = File::Read(file_, buffer_ + kept, chunkSize_);
+				total.size += result.size;
+				size_t filled = kept + result.size;
+				for (size_t position = 0; position < filled; ++position) {
+					position += Simd::FindText(buffer_ + position, filled - position, text.Data(), text.Size());
+					if (position >= filled) break;
+					if (!found(position, offset)) return total;
+				}
+				if (result.error != File::FileError::None) {
+					result.size = total.size;
+					return result;
+				}
+				if (result.size < chunkSize_) return total;
+				kept = filled < overlap ? filled : overlap;
+				memmove(buffer_, buffer_ + filled - kept, kept);
+				offset += filled - kept;
+			}
+		}
+
+		size_t chunkSize_;
+		char* buffer_;
+		size_t capacity_;
+		File::NativeFile file_;
+		File::LoadOptions options_;
+		bool open_;
+	};
+}
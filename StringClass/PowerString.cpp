@@ -3,6 +3,7 @@
 
 namespace Power {
 	size_t String::s_defaultCapacity = 256;
+	size_t String::s_parallelJoinSize = 4 * 1024 * 1024;
 	size_t String::s_instanceCounter_ = 0;
 	size_t String::s_totalInstancesCreated_ = 0;
 }
@@ -1,9 +1,24 @@
 #pragma once
 
+#include <cstdarg>
 #include <cstring>
 #include <cstdio>
 #include <inttypes.h>
 #include <cstdlib>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+
+#include "PowerCharSet.h"
+#include "PowerConcat.h"
+#include "PowerFile.h"
+#include "PowerFormat.h"
+#include "PowerNumberFormat.h"
+#include "PowerNumberParse.h"
+#include "PowerSimd.h"
+#include "PowerSplit.h"
+#include "PowerStringView.h"
+#include "PowerUtf8.h"
 
 
 #define INT16_MAX_CHR_COUNT		 7		///< Maximum character count of a signed short including the null character.
@@ -12,11 +27,13 @@
 #define UINT32_MAX_CHR_COUNT	11		///< Maximum character count of an unsigned initeger including the null character.
 #define INT64_MAX_CHR_COUNT		21		///< Maximum character count of a signed long long including the null character.
 #define UINT64_MAX_CHR_COUNT	21		///< Maximum character count of an unsigned long long including the null character.
-#define FLOAT_MAX_CHR_COUNT		13		///< Maximum character count of a float including the null character.
-#define DOUBLE_MAX_CHR_COUNT	18		///< Maximum character count of a double including the null character.
+#define FLOAT_MAX_CHR_COUNT		17		///< Maximum character count of a float in the shortest general notation including the null character.
+#define DOUBLE_MAX_CHR_COUNT	25		///< Maximum character count of a double in the shortest general notation including the null character.
 
 
 namespace Power {
+	class FileLoader;
+
 	/// @brief A mutable string class with similar functionality to the C# string.
 	/// @brief This string is capable of storing SIZE_MAX / 2 characters, but operation is only guaranteed up to INT32_MAX characters.
 	///
@@ -54,8 +71,7 @@ namespace Power {
 		///
 		static String ToString(const int16_t value) {
 			char buffer[INT16_MAX_CHR_COUNT];
-			snprintf(buffer, INT16_MAX_CHR_COUNT, "%hd", value);
-			return String(buffer);
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -65,8 +81,7 @@ namespace Power {
 		///
 		static String ToString(const uint16_t value) {
 			char buffer[UINT16_MAX_CHR_COUNT];
-			snprintf(buffer, UINT16_MAX_CHR_COUNT, "%hu", value);
-			return String(buffer);
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -76,8 +91,7 @@ namespace Power {
 		///
 		static String ToString(const int32_t value) {
 			char buffer[INT32_MAX_CHR_COUNT];
-			snprintf(buffer, INT32_MAX_CHR_COUNT, "%d", value);
-			return String(buffer);
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,8 +101,7 @@ namespace Power {
 		///
 		static String ToString(const uint32_t value) {
 			char buffer[UINT32_MAX_CHR_COUNT];
-			snprintf(buffer, UINT32_MAX_CHR_COUNT, "%u", value);
-			return String(buffer, strlen(buffer));
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,8 +111,7 @@ namespace Power {
 		///
 		static String ToString(const int64_t value) {
 			char buffer[INT64_MAX_CHR_COUNT];
-			snprintf(buffer, INT64_MAX_CHR_COUNT, "%lld", value);
-			return String(buffer);
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,30 +121,81 @@ namespace Power {
 		///
 		static String ToString(const uint64_t value) {
 			char buffer[UINT64_MAX_CHR_COUNT];
-			snprintf(buffer, UINT64_MAX_CHR_COUNT, "%llu", value);
-			return String(buffer);
+			return String(buffer, NumberFormat::Format(value, buffer));
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Converts a float value to a Power::String.
 		/// @param[in] value The float value to be converted.
-		/// @return A Power::String containing the float value.
+		/// @return A Power::String containing the float value with the fewest digits which are read back as the same value, e.g. "0.1" or "3.4028235e+38".
 		///
 		static String ToString(const float value) {
+			NumberFormat::Decimal decimal;
+			NumberFormat::ShortestDecimal(value, decimal);
 			char buffer[FLOAT_MAX_CHR_COUNT];
-			snprintf(buffer, FLOAT_MAX_CHR_COUNT, "%g", value);
-			return String(buffer);
+			size_t size = NumberFormat::DecimalLength(decimal, NumberFormat::FloatStyle::General);
+			NumberFormat::WriteDecimal(decimal, NumberFormat::FloatStyle::General, buffer);
+			return String(buffer, size);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Converts a float value to a Power::String in the specified notation.
+		/// @param[in] value The float value to be converted.
+		/// @param[in] style The notation: general (like %g), fixed (like %f) or scientific (like %e).
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for the general notation.
+		/// \n If it is negative, the fewest digits which are read back as the same value are used.
+		/// @return A Power::String containing the float value.
+		///
+		static String ToString(const float value, NumberFormat::FloatStyle style, int32_t precision = -1) {
+			String result;
+			result.Concatenate(value, style, precision);
+			return result;
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Converts a double value to a Power::String.
 		/// @param[in] value The double value to be converted.
-		/// @return A Power::String containing the double value.
+		/// @return A Power::String containing the double value with the fewest digits which are read back as the same value, e.g. "0.1" or "1.7976931348623157e+308".
 		///
 		static String ToString(const double value) {
+			NumberFormat::Decimal decimal;
+			NumberFormat::ShortestDecimal(value, decimal);
 			char buffer[DOUBLE_MAX_CHR_COUNT];
-			snprintf(buffer, DOUBLE_MAX_CHR_COUNT, "%g", value);
-			return String(buffer);
+			size_t size = NumberFormat::DecimalLength(decimal, NumberFormat::FloatStyle::General);
+			NumberFormat::WriteDecimal(decimal, NumberFormat::FloatStyle::General, buffer);
+			return String(buffer, size);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Converts a double value to a Power::String in the specified notation.
+		/// @param[in] value The double value to be converted.
+		/// @param[in] style The notation: general (like %g), fixed (like %f) or scientific (like %e).
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for the general notation.
+		/// \n If it is negative, the fewest digits which are read back as the same value are used.
+		/// @return A Power::String containing the double value.
+		///
+		static String ToString(const double value, NumberFormat::FloatStyle style, int32_t precision = -1) {
+			String result;
+			result.Concatenate(value, style, precision);
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Format-->
+		/// @brief Formats arguments according to a format string which is parsed and validated at compile time.
+		/// @param[in] format The format string, wrapped with POWER_FORMAT, e.g. POWER_FORMAT("{}: {} items in {:.3f}s").
+		/// \n Fields are "{}" or "{:[.precision][type]}". The type f, e or g selects the notation of floating point values, x or X writes integers as hexadecimal.
+		/// \n The precision is the number of digits of floating point values, or the maximum number of characters of strings.
+		/// \n Floating point values without a precision are written with the fewest digits which are read back as the same value.
+		/// @param[in] args The arguments, one per field: integers, floating point values, bools, characters, c-strings, Power::StringViews or Power::Strings.
+		/// @return A Power::String containing the formatted characters.
+		/// @note The arguments are measured first and then written with one allocation. A wrong number of arguments or an invalid field doesn't compile.
+		///
+		template<typename FormatString, typename... Args>
+		static String Format(FormatString, const Args&... args) {
+			const Formatting::Formatter<FormatString, Args...> formatter(args...);
+			String result(formatter.MaxLength());
+			result.SetNewSize(formatter.Write(result.data_));
+			return result;
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Merge-->
@@ -141,7 +204,7 @@ namespace Power {
 		/// @param[in] rhs Right-hand side of the merged Power::String.
 		/// @return A Power::String containing lhs+rhs.
 		///
-		inline static String Merge(const String& lhs, const String& rhs) { return String(lhs, rhs); }
+		inline static String Merge(const String& lhs, const String& rhs) { return lhs + rhs; }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges a Power::String with a c-string.
@@ -150,7 +213,7 @@ namespace Power {
 		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use Merge(const String&, const char) instead.
 		/// @return A Power::String containing lhs+rhs.
 		///
-		inline static String Merge(const String& lhs, const char* const rhs) { return String(lhs, rhs); }
+		inline static String Merge(const String& lhs, const char* const rhs) { return lhs + rhs; }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges a c-string with a Power::String.
@@ -167,7 +230,7 @@ namespace Power {
 		/// @param[in] rhs Right-hand side of the merged Power::String.
 		/// @return A Power::String containing lhs+rhs.
 		///
-		inline static String Merge(const String& lhs, const char rhs) { return String(lhs, rhs); }
+		inline static String Merge(const String& lhs, const char rhs) { return lhs + rhs; }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges a character with a Power::String.
@@ -177,6 +240,22 @@ namespace Power {
 		///
 		inline static String Merge(const char lhs, const String& rhs) { return String(lhs, rhs); }
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Concat-->
+		/// @brief Merges any number of operands into one Power::String.
+		/// @param[in] args Power::Strings, Power::StringViews, c-strings, string literals, characters, integer or floating point values and bools.
+		/// \n Floating point values are written with the fewest digits which are read back as the same value, bools as "true" or "false".
+		/// \n Unlike the addition operators, which have no bool overload and write a bool as the integer 1 or 0.
+		/// @return A Power::String containing all operands with the exact capacity.
+		/// @note All operands are measured in one pass and copied with one allocation. The sizes of string literals are known at compile time.
+		///
+		template<typename... Args>
+		static String Concat(const Args&... args) {
+			Formatting::FormatArgument arguments[] = { Formatting::MakeArgument(args)..., Formatting::FormatArgument('\0') };
+			String result(Formatting::MeasureArguments(arguments, sizeof...(Args)));
+			result.SetNewSize(Formatting::WriteArguments(arguments, sizeof...(Args), result.data_));
+			return result;
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Join-->
 		/// @brief Merges multiple Power::Strings with the specified seperator between each Power::String.
 		/// @param[in] space The seperator which will be placed between each Power::String.
@@ -184,19 +263,7 @@ namespace Power {
 		/// @param[in] size The size of the specified Power::String array.
 		/// @return A Power::String containing the merged Power::Strings.
 		///
-		inline static String Join(const String& space, const String* const others, size_t size) {
-			size_t totalSize = (size - 1) * space.size_;
-			for (size_t i = 0; i < size; ++i) totalSize += others[i].size_;
-			String newString = String("", totalSize);
-			memcpy(newString.data_, others[0].data_, others[0].size_);
-			char* data = newString.data_ + others[0].size_ + space.size_;
-			for (size_t i = 1; i < size; ++i) {
-				memcpy(data, others[i].data_, others[i].size_);
-				memcpy(data - space.size_, space.data_, space.size_);
-				data += others[i].size_ + space.size_;
-			}
-			return newString;
-		}
+		inline static String Join(const String& space, const String* const others, size_t size) { return String::JoinRange(space.data_, space.size_, others, others + size); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges multiple Power::Strings with the specified seperator between each Power::String.
@@ -218,19 +285,7 @@ namespace Power {
 		/// @param[in] size The size of the specified Power::String array.
 		/// @return A Power::String containing the merged Power::Strings.
 		///
-		inline static String Join(const char* const space, size_t spaceSize, const String* const others, size_t size) {
-			size_t totalSize = (size - 1) * spaceSize;
-			for (size_t i = 0; i < size; ++i) totalSize += others[i].size_;
-			String newString = String("", totalSize);
-			memcpy(newString.data_, others[0].data_, others[0].size_);
-			char* data = newString.data_ + others[0].size_ + spaceSize;
-			for (size_t i = 1; i < size; ++i) {
-				memcpy(data, others[i].data_, others[i].size_);
-				memcpy(data - spaceSize, space, spaceSize);
-				data += others[i].size_ + spaceSize;
-			}
-			return newString;
-		}
+		inline static String Join(const char* const space, size_t spaceSize, const String* const others, size_t size) { return String::JoinRange(space, spaceSize, others, others + size); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges multiple Power::Strings with the specified seperator between each Power::String.
@@ -239,17 +294,7 @@ namespace Power {
 		/// @param[in] size The size of the specified Power::String array.
 		/// @return A Power::String containing the merged Power::Strings.
 		///
-		inline static String Join(const char c, const String* const others, size_t size) {
-			size_t totalSize = size - 1;
-			for (size_t i = 0; i < size; ++i) totalSize += others[i].size_;
-			String newString = String(c, totalSize);
-			char* data = newString.data_;
-			for (size_t i = 0; i < size; ++i) {
-				memcpy(data, others[i].data_, others[i].size_);
-				data += others[i].size_ + 1;
-			}
-			return newString;
-		}
+		inline static String Join(const char c, const String* const others, size_t size) { return String::JoinRange(&c, 1, others, others + size); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges multiple c-strings with the specified seperator between each Power::String.
@@ -258,21 +303,7 @@ namespace Power {
 		/// @param[in] size The size of the specified c-string array.
 		/// @return A Power::String containing the merged c-strings.
 		///
-		inline static String Join(const String& space, const char* const* const others, size_t size) {
-			size_t totalSize = (size - 1) * space.size_;
-			for (size_t i = 0; i < size; ++i) totalSize += strlen(others[i]);
-			String newString = String("", totalSize);
-			size_t otherSize = strlen(others[0]);
-			memcpy(newString.data_, others[0], otherSize);
-			char* data = newString.data_ + otherSize + space.size_;
-			for (size_t i = 1; i < size; ++i) {
-				otherSize = strlen(others[i]);
-				memcpy(data, others[i], otherSize);
-				memcpy(data - space.size_, space.data_, space.size_);
-				data += otherSize + space.size_;
-			}
-			return newString;
-		}
+		inline static String Join(const String& space, const char* const* const others, size_t size) { return String::JoinRange(space.data_, space.size_, others, others + size); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges multiple c-strings with the specified seperator between each Power::String.
@@ -294,21 +325,7 @@ namespace Power {
 		/// @param[in] size The size of the specified c-string array.
 		/// @return A Power::String containing the merged c-strings.
 		///
-		inline static String Join(const char* const space, size_t spaceSize, const char* const* const others, size_t size) {
-			size_t totalSize = (size - 1) * spaceSize;
-			for (size_t i = 0; i < size; ++i) totalSize += strlen(others[i]);
-			String newString = String("", totalSize);
-			size_t otherSize = strlen(others[0]);
-			memcpy(newString.data_, others[0], otherSize);
-			char* data = newString.data_ + otherSize + spaceSize;
-			for (size_t i = 1; i < size; ++i) {
-				otherSize = strlen(others[i]);
-				memcpy(data, others[i], otherSize);
-				memcpy(data - spaceSize, space, spaceSize);
-				data += otherSize + spaceSize;
-			}
-			return newString;
-		}
+		inline static String Join(const char* const space, size_t spaceSize, const char* const* const others, size_t size) { return String::JoinRange(space, spaceSize, others, others + size); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges multiple c-strings with the specified seperator between each Power::String.
@@ -317,18 +334,48 @@ namespace Power {
 		/// @param[in] size The size of the specified c-string array.
 		/// @return A Power::String containing the merged c-strings.
 		///
-		inline static String Join(const char c, const char* const* const others, size_t size) {
-			size_t totalSize = size - 1;
-			for (size_t i = 0; i < size; ++i) totalSize += strlen(others[i]);
-			String newString = String(c, totalSize);
-			char* data = newString.data_;
-			for (size_t i = 0; i < size; ++i) {
-				size_t otherSize = strlen(others[i]);
-				memcpy(data, others[i], otherSize);
-				data += otherSize + 1;
-			}
-			return newString;
-		}
+		inline static String Join(const char c, const char* const* const others, size_t size) { return String::JoinRange(&c, 1, others, others + size); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges all elements of a range with the specified seperator between each element.
+		/// @param[in] space The seperator which will be placed between each element.
+		/// @param[in] others Any range of Power::Strings, Power::StringViews or c-strings, which can be iterated with std::begin and std::end, e.g. an array or a std::vector.
+		/// @return A Power::String containing the merged elements.
+		/// @note The size of each element is measured once. If the merged Power::String is at least s_parallelJoinSize characters long, it is copied by multiple threads.
+		///
+		template<typename Range>
+		inline static String Join(const String& space, const Range& others) { return String::JoinRange(space.data_, space.size_, std::begin(others), std::end(others)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges all elements of a range with the specified seperator between each element.
+		/// @param[in] space The seperator which will be placed between each element.
+		/// @param[in] others Any range of Power::Strings, Power::StringViews or c-strings, which can be iterated with std::begin and std::end, e.g. an array or a std::vector.
+		/// @return A Power::String containing the merged elements.
+		/// @note The size of each element is measured once. If the merged Power::String is at least s_parallelJoinSize characters long, it is copied by multiple threads.
+		///
+		template<typename Range>
+		inline static String Join(const StringView& space, const Range& others) { return String::JoinRange(space.Data(), space.Size(), std::begin(others), std::end(others)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges all elements of a range with the specified seperator between each element.
+		/// @param[in] space The seperator which will be placed between each element.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use Join(const char, const Range&) instead.
+		/// @param[in] others Any range of Power::Strings, Power::StringViews or c-strings, which can be iterated with std::begin and std::end, e.g. an array or a std::vector.
+		/// @return A Power::String containing the merged elements.
+		/// @note The size of each element is measured once. If the merged Power::String is at least s_parallelJoinSize characters long, it is copied by multiple threads.
+		///
+		template<typename Range>
+		inline static String Join(const char* const space, const Range& others) { return String::JoinRange(space, strlen(space), std::begin(others), std::end(others)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges all elements of a range with the specified seperator between each element.
+		/// @param[in] c The seperator which will be placed between each element.
+		/// @param[in] others Any range of Power::Strings, Power::StringViews or c-strings, which can be iterated with std::begin and std::end, e.g. an array or a std::vector.
+		/// @return A Power::String containing the merged elements.
+		/// @note The size of each element is measured once. If the merged Power::String is at least s_parallelJoinSize characters long, it is copied by multiple threads.
+		///
+		template<typename Range>
+		inline static String Join(const char c, const Range& others) { return String::JoinRange(&c, 1, std::begin(others), std::end(others)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SplitStringAt-->
 		/// @brief Splits a Power::String into two substrings at the specified index.
@@ -364,6 +411,217 @@ namespace Power {
 			return String(fp, filePath);
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryLoadUtf8FileIntoString-->
+		/// @brief Loads the specified file into the specified Power::String, if it contains valid UTF-8.
+		/// @param[in] filePath The path of the file to be loaded.
+		/// @param[out] destination The Power::String the file data will be written to.
+		/// \n If the file can't be opened or its size can't be determined, it is left unchanged. If the file data isn't valid UTF-8, it is left empty.
+		/// @return <span style="color:#30AA00">True</span>, if the file was loaded and is valid UTF-8.
+		/// @return <span style="color:#CC3000">False</span>, if the file couldn't be opened, its size couldn't be determined or it isn't valid UTF-8.
+		/// @note <b>The file is read in binary mode, so line endings are validated and loaded as they are stored.</b>
+		///
+		inline static bool TryLoadUtf8FileIntoString(const String& filePath, String& destination) { return TryLoadUtf8FileIntoString(filePath.CString(), destination); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Loads the specified file into the specified Power::String, if it contains valid UTF-8.
+		/// @param[in] filePath The path of the file to be loaded.
+		/// @param[out] destination The Power::String the file data will be written to.
+		/// \n If the file can't be opened or its size can't be determined, it is left unchanged. If the file data isn't valid UTF-8, it is left empty.
+		/// @return <span style="color:#30AA00">True</span>, if the file was loaded and is valid UTF-8.
+		/// @return <span style="color:#CC3000">False</span>, if the file couldn't be opened, its size couldn't be determined or it isn't valid UTF-8.
+		/// @note <b>The file is read in binary mode, so line endings are validated and loaded as they are stored.</b>
+		///
+		inline static bool TryLoadUtf8FileIntoString(const char* const filePath, String& destination) {
+			FILE* fp = nullptr;
+			if (fopen_s(&fp, filePath, "rb")) return false;
+			fseek(fp, 0, SEEK_END);
+			long position = ftell(fp);
+			if (position < 0) {
+				fclose(fp);
+				return false;
+			}
+			size_t size = static_cast<size_t>(position);
+			fseek(fp, 0, SEEK_SET);
+			destination.CheckCapacityAndReallocate(size);
+			size = fread_s(destination.data_, size, 1, size, fp);
+			fclose(fp);
+			destination.SetNewSize(size);
+			if (destination.IsValidUtf8()) return true;
+			destination.SetNewSize(0);
+			return false;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryLoadFile-->
+		/// @brief Loads the specified file in binary mode into the specified Power::String.
+		/// @param[in] filePath The path of the file to be loaded.
+		/// @param[out] destination The Power::String the file data will be written to. It is left unchanged, if the file can't be opened.
+		/// @param[in] options The File::LoadOptions, e.g. File::LoadOptions::Sequential | File::LoadOptions::DropCache.
+		/// @return The File::FileResult with the number of characters read. If reading fails, the characters read so far are kept.
+		///
+		inline static File::FileResult TryLoadFile(const String& filePath, String& destination, File::LoadOptions options = File::LoadOptions::Sequential) { return TryLoadFile(filePath.CString(), destination, options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Loads the specified file in binary mode into the specified Power::String.
+		/// @param[in] filePath The path of the file to be loaded.
+		/// @param[out] destination The Power::String the file data will be written to. It is left unchanged, if the file can't be opened.
+		/// @param[in] options The File::LoadOptions, e.g. File::LoadOptions::Sequential | File::LoadOptions::DropCache.
+		/// @return The File::FileResult with the number of characters read. If reading fails, the characters read so far are kept.
+		/// @note The size of the file is known before reading, so it is read with a single pass into a buffer sized for it,
+		/// \n unless the Power::String is already large enough. Files of unknown size, e.g. pipes, are read in growing steps.
+		/// \n <b>Like every Power::String, the buffer also holds the temporary half used by modifying operations, so loading a file
+		/// \n allocates twice its size. Use Power::MappedFile to process large files without copying them.</b>
+		///
+		inline static File::FileResult TryLoadFile(const char* const filePath, String& destination, File::LoadOptions options = File::LoadOptions::Sequential) {
+			File::NativeFile file;
+			uint64_t fileSize = 0;
+			File::FileResult result = File::OpenForReading(filePath, options, file, fileSize);
+			if (result.error != File::FileError::None) return result;
+			if (fileSize >= SIZE_MAX / 4) {
+				File::Close(file, options);
+				return File::MakeResult(0, File::FileError::OutOfMemory);
+			}
+			size_t size = static_cast<size_t>(fileSize);
+			if (size >= destination.capacity_) destination.Reallocate(size + 1);
+			if (size > 0) result = File::Read(file, destination.data_, size);
+			else {
+				// The size is unknown, so the buffer is filled and grown until the end of the file is reached.
+				while (result.error == File::FileError::None) {
+					File::FileResult part = File::Read(file, destination.data_ + result.size, destination.capacity_ - 1 - result.size);
+					part.size += result.size;
+					result = part;
+					if (result.size < destination.capacity_ - 1) break;
+					destination.CheckCapacityAndReallocate(result.size + 1);
+				}
+			}
+			File::Close(file, options);
+			destination.SetNewSize(result.size);
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SaveToFile-->
+		/// @brief Writes the Power::String to the specified file in binary mode, replacing its content.
+		/// @param[in] filePath The path of the file. It is created, if it doesn't exist.
+		/// @param[in] options The File::SaveOptions, e.g. File::SaveOptions::AtomicReplace | File::SaveOptions::Sync.
+		/// @return The File::FileResult with the number of characters written.
+		///
+		inline File::FileResult SaveToFile(const String& filePath, File::SaveOptions options = File::SaveOptions::None) const { return this->SaveToFile(filePath.CString(), options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes the Power::String to the specified file in binary mode, replacing its content.
+		/// @param[in] filePath The path of the file. It is created, if it doesn't exist.
+		/// @param[in] options The File::SaveOptions, e.g. File::SaveOptions::AtomicReplace | File::SaveOptions::Sync.
+		/// @return The File::FileResult with the number of characters written.
+		/// @note The characters are written directly from the Power::String without the buffer of the C runtime, at most 1GB per system call.
+		///
+		inline File::FileResult SaveToFile(const char* const filePath, File::SaveOptions options = File::SaveOptions::None) const {
+			File::FileWriter writer;
+			File::FileResult result = writer.Open(filePath, options);
+			if (result.error != File::FileError::None) return result;
+			result = writer.Write(data_, size_);
+			if (result.error != File::FileError::None) return result;
+			return writer.Commit();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SaveJoinedToFile-->
+		/// @brief Writes the elements of a range with a seperator between each of them to the specified file, like Join without creating the joined Power::String.
+		/// @param[in] filePath The path of the file. It is created, if it doesn't exist.
+		/// @param[in] space The seperator.
+		/// @param[in] others A range of Power::Strings, Power::StringViews or c-strings, e.g. a std::vector or an array.
+		/// @param[in] options The File::SaveOptions, e.g. File::SaveOptions::AtomicReplace | File::SaveOptions::Sync.
+		/// @return The File::FileResult with the number of characters written.
+		/// @note Small elements and seperators are copied into a buffer, large ones are written from where they are, with a single writev call per batch on POSIX.
+		///
+		template<typename Range>
+		inline static File::FileResult SaveJoinedToFile(const char* const filePath, const StringView& space, const Range& others, File::SaveOptions options = File::SaveOptions::None) {
+			File::FileWriter writer;
+			File::FileResult result = writer.Open(filePath, options);
+			if (result.error != File::FileError::None) return result;
+			bool first = true;
+			for (auto element = std::begin(others); element != std::end(others); ++element) {
+				if (!first) result = writer.Append(space.Data(), space.Size());
+				first = false;
+				if (result.error != File::FileError::None) return result;
+				StringView part = JoinElement(*element);
+				result = writer.Append(part.Data(), part.Size());
+				if (result.error != File::FileError::None) return result;
+			}
+			return writer.Commit();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SaveAllToFile-->
+		/// @brief Writes the elements of a range one after another to the specified file without concatenating them first.
+		/// @param[in] filePath The path of the file. It is created, if it doesn't exist.
+		/// @param[in] others A range of Power::Strings, Power::StringViews or c-strings, e.g. a std::vector or an array.
+		/// @param[in] options The File::SaveOptions, e.g. File::SaveOptions::AtomicReplace | File::SaveOptions::Sync.
+		/// @return The File::FileResult with the number of characters written.
+		///
+		template<typename Range>
+		inline static File::FileResult SaveAllToFile(const char* const filePath, const Range& others, File::SaveOptions options = File::SaveOptions::None) { return SaveJoinedToFile(filePath, StringView(), others, options); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteTo-->
+		/// @brief Writes the Power::String to a file stream.
+		/// @param[in] file The file stream.
+		/// @return <span style="color:#30AA00">True</span>, if all characters were written.
+		/// @return <span style="color:#CC3000">False</span>, if writing failed.
+		///
+		inline bool WriteTo(FILE* file) const { return fwrite(data_, 1, size_, file) == size_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes the Power::String to a file descriptor, bypassing the buffer of the C runtime.
+		/// @param[in] fd The file descriptor.
+		/// @return <span style="color:#30AA00">True</span>, if all characters were written.
+		/// @return <span style="color:#CC3000">False</span>, if writing failed.
+		///
+		inline bool WriteTo(int fd) const { return File::WriteToDescriptor(fd, data_, size_).error == File::FileError::None; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryFromUtf8-->
+		/// @brief Copies the specified characters into the specified Power::String, if they are valid UTF-8.
+		/// @param[in] data The characters to be copied.
+		/// @param[in] size The number of characters to be copied.
+		/// @param[out] destination The Power::String the characters will be copied to. It is left unchanged, if the characters aren't valid UTF-8.
+		/// @return <span style="color:#30AA00">True</span>, if the characters are valid UTF-8 and were copied.
+		/// @return <span style="color:#CC3000">False</span>, if they aren't.
+		///
+		inline static bool TryFromUtf8(const char* const data, size_t size, String& destination) {
+			if (!Utf8::IsValid(data, size)) return false;
+			destination.CheckCapacityAndReallocate(size);
+			memmove(destination.data_, data, size);
+			destination.SetNewSize(size);
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FromUtf16-->
+		/// @brief Transcodes the specified UTF-16 code units into the specified Power::String as UTF-8.
+		/// @param[in] data The UTF-16 code units.
+		/// @param[in] size The number of code units.
+		/// @param[out] destination The Power::String receiving the UTF-8 encoded characters. Its previous content is overwritten.
+		/// \n If an unpaired surrogate is found, it contains the characters in front of it.
+		/// @return The number of written bytes and the offset of the first unpaired surrogate, which is equal to size, if there is none.
+		/// @note The exact UTF-8 size is calculated up front, so the Power::String is allocated at most once.
+		///
+		inline static Utf8::TranscodeResult FromUtf16(const char16_t* const data, size_t size, String& destination) {
+			destination.CheckCapacityAndReallocate(Utf8::LengthFromUtf16(data, size));
+			Utf8::TranscodeResult result = Utf8::FromUtf16(data, size, destination.data_);
+			destination.SetNewSize(result.written);
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FromUtf32-->
+		/// @brief Transcodes the specified code points into the specified Power::String as UTF-8.
+		/// @param[in] data The code points.
+		/// @param[in] size The number of code points.
+		/// @param[out] destination The Power::String receiving the UTF-8 encoded characters. Its previous content is overwritten.
+		/// \n If a surrogate or a code point above U+10FFFF is found, it contains the characters in front of it.
+		/// @return The number of written bytes and the offset of the first invalid code point, which is equal to size, if there is none.
+		/// @note The exact UTF-8 size is calculated up front, so the Power::String is allocated at most once.
+		///
+		inline static Utf8::TranscodeResult FromUtf32(const char32_t* const data, size_t size, String& destination) {
+			destination.CheckCapacityAndReallocate(Utf8::LengthFromUtf32(data, size));
+			Utf8::TranscodeResult result = Utf8::FromUtf32(data, size, destination.data_);
+			destination.SetNewSize(result.written);
+			return result;
+		}
+
 	public:
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
 		/// @brief Initializes a new Power::String with the default capacity.
@@ -372,7 +630,8 @@ namespace Power {
 			capacity_(s_defaultCapacity),
 			size_(0),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			*data_ = '\0';
 			this->IncInstCounter();
@@ -386,7 +645,8 @@ namespace Power {
 			capacity_(size + 1),
 			size_(0),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			*data_ = '\0';
 			this->IncInstCounter();
@@ -403,7 +663,8 @@ namespace Power {
 			capacity_(0),
 			size_(0),
 			data_(nullptr),
-			temp_(nullptr)
+			temp_(nullptr),
+			codePointIndex_(nullptr)
 		{
 			size_ = strlen(data);
 			capacity_ = size_ + s_defaultCapacity;
@@ -423,7 +684,8 @@ namespace Power {
 			capacity_(s_defaultCapacity),
 			size_(1),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			*data_ = c;
 			data_[1] = '\0';
@@ -440,13 +702,20 @@ namespace Power {
 			capacity_(size + s_defaultCapacity),
 			size_(size),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			memcpy(data_, data, size_);
 			data_[size_] = '\0';
 			this->IncInstCounter();
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a new Power::String containing a copy of the characters of the specified Power::StringView.
+		/// @param[in] view The Power::StringView with the data.
+		///
+		explicit String(const StringView& view) : String(view.Data(), view.Size()) {}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Initializes a new Power::String and fills it to the specified size with the specified character.
 		/// @param[in] c The character to fill with.
@@ -456,7 +725,8 @@ namespace Power {
 			capacity_(size + s_defaultCapacity),
 			size_(size),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			memset(data_, c, size_);
 			data_[size_] = '\0';
@@ -471,13 +741,32 @@ namespace Power {
 			capacity_(other.capacity_),
 			size_(other.size_),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			memcpy(data_, other.data_, other.size_);
 			data_[size_] = '\0';
 			this->IncInstCounter();
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a new Power::String with the operands of a Power::Concatenation, e.g. a + b + c.
+		/// @param[in] concatenation The Power::Concatenation.
+		/// @note The capacity is the size plus the null character, and all operands are written with one allocation.
+		///
+		template<typename Left>
+		String(const Concatenation<Left>& concatenation) :
+			capacity_(concatenation.Size() + 1),
+			size_(concatenation.Size()),
+			data_(static_cast<char*>(malloc(capacity_ * 2))),
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
+		{
+			concatenation.Write(data_);
+			data_[size_] = '\0';
+			this->IncInstCounter();
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Assignment operators-->
 		/// @brief Assignes the content of another Power::String to the Power::String.
 		/// @param other The Power::String to be assigned.
@@ -515,83 +804,101 @@ namespace Power {
 			this->SetNewSize(1);
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Assigns the operands of a Power::Concatenation, e.g. a + b + c, to the Power::String.
+		/// @param concatenation The Power::Concatenation to be assigned.
+		/// @note The operands are written directly into the Power::String, which may also be the one on the very left, like in s = s + x.
+		/// \n Only if another operand points into the Power::String, they are written into a new Power::String first.
+		///
+		template<typename Left>
+		inline void operator=(const Concatenation<Left>& concatenation) {
+			if (concatenation.References(data_, size_)) {
+				*this = String(concatenation);
+				return;
+			}
+			size_t newSize = concatenation.Size();
+			this->CheckCapacityAndReallocate(newSize);
+			concatenation.Write(data_);
+			this->SetNewSize(newSize);
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Addition operators-->
 		/// @brief Merges the Power::String with another Power::String.
 		/// @param[in] other The Power::String to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const String& other) const { return String(*this, other); }
+		inline Concatenation<String> operator+(const String& other) const { return Concatenation<String>(*this, Formatting::FormatArgument(other)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a c-string.
 		/// @param[in] other The c-string to be merged with.
 		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use operator+(const char) const instead.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const char* const other) const { return String(*this, other); }
+		inline Concatenation<String> operator+(const char* const other) const { return Concatenation<String>(*this, Formatting::FormatArgument(other)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a character.
 		/// @param[in] c The character to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const char c) const { return String(*this, c); }
+		inline Concatenation<String> operator+(const char c) const { return Concatenation<String>(*this, Formatting::FormatArgument(c)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a signed short value.
 		/// @param[in] value The signed short value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const int16_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const int16_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a unsigned short value.
 		/// @param[in] value The unsigned short value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const uint16_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const uint16_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a signed integer value.
 		/// @param[in] value The signed integer value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const int32_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const int32_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a unsigned integer value.
 		/// @param[in] value The unsigned integer value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const uint32_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const uint32_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a signed long long value.
 		/// @param[in] value The signed long long value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const int64_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const int64_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a unsigned long long value.
 		/// @param[in] value The unsigned long long value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const uint64_t value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const uint64_t value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a float value.
 		/// @param[in] value The float value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const float value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const float value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a double value.
 		/// @param[in] value The double value to be merged with.
-		/// @return A copy of the new Power::String.
+		/// @return A lazy Power::Concatenation, which is materialized with one allocation when it is converted or assigned to a Power::String.
 		///
-		inline String operator+(const double value) const { return String(*this, value); }
+		inline Concatenation<String> operator+(const double value) const { return Concatenation<String>(*this, Formatting::FormatArgument(value)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Compound addition operators-->
 		/// @brief Merges the Power::String with another Power::String.
@@ -617,13 +924,11 @@ namespace Power {
 		/// @param[in] value The signed short value to be merged with.
 		///
 		inline void operator+=(const int16_t value) {
-			char buffer[INT16_MAX_CHR_COUNT];
-			snprintf(buffer, INT16_MAX_CHR_COUNT, "%hd", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -631,13 +936,11 @@ namespace Power {
 		/// @param[in] value The unsigned short value to be merged with.
 		///
 		inline void operator+=(const uint16_t value) {
-			char buffer[UINT16_MAX_CHR_COUNT];
-			snprintf(buffer, UINT16_MAX_CHR_COUNT, "%hu", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,13 +948,11 @@ namespace Power {
 		/// @param[in] value The signed integer value to be merged with.
 		///
 		inline void operator+=(const int32_t value) {
-			char buffer[INT32_MAX_CHR_COUNT];
-			snprintf(buffer, INT32_MAX_CHR_COUNT, "%d", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -659,13 +960,11 @@ namespace Power {
 		/// @param[in] value The unsigned integer value to be merged with.
 		///
 		inline void operator+=(const uint32_t value) {
-			char buffer[UINT32_MAX_CHR_COUNT];
-			snprintf(buffer, UINT32_MAX_CHR_COUNT, "%u", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -673,13 +972,11 @@ namespace Power {
 		/// @param[in] value The signed long long value to be merged with.
 		///
 		inline void operator+=(const int64_t value) {
-			char buffer[INT64_MAX_CHR_COUNT];
-			snprintf(buffer, INT64_MAX_CHR_COUNT, "%lld", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -687,42 +984,24 @@ namespace Power {
 		/// @param[in] value The unsigned long long value to be merged with.
 		///
 		inline void operator+=(const uint64_t value) {
-			char buffer[UINT64_MAX_CHR_COUNT];
-			snprintf(buffer, UINT64_MAX_CHR_COUNT, "%llu", value);
-			size_t otherSize = strlen(buffer);
+			size_t otherSize = NumberFormat::Length(value);
 			size_t newSize = size_ + otherSize;
 			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
+			NumberFormat::Write(value, data_ + size_, otherSize);
+			this->SetNewSize(newSize);
 		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a float value.
 		/// @param[in] value The float value to be merged with.
 		///
-		inline void operator+=(const float value) {
-			char buffer[FLOAT_MAX_CHR_COUNT];
-			snprintf(buffer, FLOAT_MAX_CHR_COUNT, "%g", value);
-			size_t otherSize = strlen(buffer);
-			size_t newSize = size_ + otherSize;
-			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
-		}
+		inline void operator+=(const float value) { this->Concatenate(value, NumberFormat::FloatStyle::General); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges the Power::String with a double value.
 		/// @param[in] value The double value to be merged with.
 		///
-		inline void operator+=(const double value) {
-			char buffer[DOUBLE_MAX_CHR_COUNT];
-			snprintf(buffer, DOUBLE_MAX_CHR_COUNT, "%g", value);
-			size_t otherSize = strlen(buffer);
-			size_t newSize = size_ + otherSize;
-			this->CheckCapacityAndReallocate(newSize);
-			memcpy(data_ + size_, buffer, otherSize + 1);
-			size_ = newSize;
-		}
+		inline void operator+=(const double value) { this->Concatenate(value, NumberFormat::FloatStyle::General); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Bitwise left shift operators-->
 		/// @brief Merges the Power::String with another Power::String.
@@ -911,11 +1190,131 @@ namespace Power {
 		///
 		inline String& Concatenate(const char c) {
 			this->CheckCapacityAndReallocate(++size_);
+			this->InvalidateCodePointIndex();
 			data_[size_ - 1] = c;
 			data_[size_] = '\0';
 			return *this;
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges the Power::String with a float value in the specified notation. The characters are written directly behind the Power::String.
+		/// @param[in] value The float value to be merged with.
+		/// @param[in] style The notation: general (like %g), fixed (like %f) or scientific (like %e).
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for the general notation.
+		/// \n If it is negative, the fewest digits which are read back as the same float value are used.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& Concatenate(const float value, NumberFormat::FloatStyle style, int32_t precision = -1) {
+			if (precision >= 0) return this->ConcatenatePrecise(value, style, precision);
+			NumberFormat::Decimal decimal;
+			NumberFormat::ShortestDecimal(value, decimal);
+			return this->ConcatenateDecimal(decimal, style);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges the Power::String with a double value in the specified notation. The characters are written directly behind the Power::String.
+		/// @param[in] value The double value to be merged with.
+		/// @param[in] style The notation: general (like %g), fixed (like %f) or scientific (like %e).
+		/// @param[in] precision The number of digits behind the decimal point, or the number of significant digits for the general notation.
+		/// \n If it is negative, the fewest digits which are read back as the same double value are used.
+		/// @return A reference to the current Power::String.
+		/// @note The shortest digits are found with Grisu2 and written without snprintf. Fixed precisions are rounded by snprintf.
+		///
+		inline String& Concatenate(const double value, NumberFormat::FloatStyle style, int32_t precision = -1) {
+			if (precision >= 0) return this->ConcatenatePrecise(value, style, precision);
+			NumberFormat::Decimal decimal;
+			NumberFormat::ShortestDecimal(value, decimal);
+			return this->ConcatenateDecimal(decimal, style);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ConcatenateFormat-->
+		/// @brief Merges the Power::String with arguments formatted according to a format string which is parsed and validated at compile time.
+		/// @param[in] format The format string, wrapped with POWER_FORMAT. See Format(FormatString, const Args&...) for the fields.
+		/// @param[in] args The arguments, one per field.
+		/// @return A reference to the current Power::String.
+		/// @note The characters are written directly behind the Power::String, which is only reallocated, if the capacity is too small.
+		///
+		template<typename FormatString, typename... Args>
+		inline String& ConcatenateFormat(FormatString, const Args&... args) {
+			Formatting::Formatter<FormatString, Args...> formatter(args...);
+			const uintptr_t oldData = reinterpret_cast<uintptr_t>(data_);
+			this->CheckCapacityAndReallocate(size_ + formatter.MaxLength());
+			if (reinterpret_cast<uintptr_t>(data_) != oldData) formatter.Relocate(oldData, size_, data_);
+			this->SetNewSize(size_ + formatter.Write(data_ + size_));
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--AppendAll-->
+		/// @brief Merges the Power::String with any number of operands.
+		/// @param[in] args Power::Strings, Power::StringViews, c-strings, string literals, characters, integer or floating point values and bools, written like by Concat(const Args&...).
+		/// \n They may point into the Power::String itself.
+		/// @return A reference to the current Power::String.
+		/// @note All operands are measured in one pass, so the Power::String is reallocated once at most.
+		///
+		template<typename... Args>
+		inline String& AppendAll(const Args&... args) {
+			Formatting::FormatArgument arguments[] = { Formatting::MakeArgument(args)..., Formatting::FormatArgument('\0') };
+			const uintptr_t oldData = reinterpret_cast<uintptr_t>(data_);
+			this->CheckCapacityAndReallocate(size_ + Formatting::MeasureArguments(arguments, sizeof...(Args)));
+			if (reinterpret_cast<uintptr_t>(data_) != oldData) {
+				for (size_t i = 0; i < sizeof...(Args); ++i) arguments[i].Relocate(oldData, size_, data_);
+			}
+			this->SetNewSize(size_ + Formatting::WriteArguments(arguments, sizeof...(Args), data_ + size_));
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--AppendFormat-->
+		/// @brief Merges the Power::String with arguments formatted by vsnprintf according to a printf format string.
+		/// @param[in] format The printf format string.
+		/// @param[in] ... The arguments of the format string.
+		/// @return A reference to the current Power::String.
+		/// @note The characters are written directly into the spare capacity. Only if they don't fit, the Power::String grows and they are written again.
+		/// \n If the format string is invalid, the Power::String is not changed.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: Like with snprintf, arguments must not point into the Power::String itself, as its
+		/// \n terminating null character is overwritten. Use Concat(const Args&...) or AppendAll(const Args&...) for those.
+		///
+		inline String& AppendFormat(const char* const format, ...) {
+			va_list arguments;
+			va_start(arguments, format);
+			this->AppendFormatV(format, arguments);
+			va_end(arguments);
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Merges the Power::String with arguments formatted by vsnprintf according to a printf format string.
+		/// @param[in] format The printf format string.
+		/// @param[in] arguments The arguments of the format string. They are copied with va_copy, so the caller still has to call va_end.
+		/// @return A reference to the current Power::String.
+		/// @note The characters are written directly into the spare capacity. Only if they don't fit, the Power::String grows and they are written again.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: Like with snprintf, arguments must not point into the Power::String itself, as its
+		/// \n terminating null character is overwritten. Use Concat(const Args&...) or AppendAll(const Args&...) for those.
+		///
+		inline String& AppendFormatV(const char* const format, va_list arguments) {
+			va_list retry;
+			va_copy(retry, arguments);
+			int written = vsnprintf(data_ + size_, capacity_ - size_, format, arguments);
+			if (written < 0) {
+				va_end(retry);
+				data_[size_] = '\0';
+				return *this;
+			}
+			size_t newSize = size_ + written;
+			if (newSize >= capacity_) {
+				size_t newCapacity = capacity_ * 2 + newSize;
+				char* newData = static_cast<char*>(malloc(newCapacity * 2));
+				memcpy(newData, data_, size_);
+				vsnprintf(newData + size_, newCapacity - size_, format, retry);
+				free(data_);
+				capacity_ = newCapacity;
+				data_ = newData;
+				temp_ = data_ + capacity_;
+			}
+			va_end(retry);
+			this->SetNewSize(newSize);
+			return *this;
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Merges a c-string with the Power::String. The c-string will be placed before the Power::String.
 		/// @param[in] other The c-string to be merged with.
@@ -956,6 +1355,7 @@ namespace Power {
 		///
 		inline String& ConcatenateAfter(const char c) {
 			this->CheckCapacityAndReallocate(++size_);
+			this->InvalidateCodePointIndex();
 			memcpy(temp_, data_, size_ - 1);
 			*data_ = c;
 			memcpy(data_ + 1, temp_, size_ - 1);
@@ -1504,6 +1904,80 @@ namespace Power {
 			return String(data_ + begin, end - begin);
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--View-->
+		/// @brief Creates a view of the Power::String.
+		/// @return A Power::StringView of all characters.
+		/// @note <b>The view is invalidated by any modification of the Power::String.</b>
+		///
+		inline StringView View() const { return StringView(data_, size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view from the specified start index to the specified end index without copying.
+		/// @param[in] begin The index from where to start.
+		/// @param[in] end The index to where to stop.
+		/// @return A Power::StringView of the substring.
+		/// @return The returned Power::StringView will be empty, if the start index is greater than the end index or the size of the Power::String.
+		/// @note <b>The view is invalidated by any modification of the Power::String.</b>
+		///
+		inline StringView View(size_t begin, size_t end) const { return this->View().Substring(begin, end); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Split-->
+		/// @brief Splits the Power::String at each occurance of a character without copying.
+		/// @param[in] c The delimiter.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::String.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note <b>The parts are invalidated by any modification of the Power::String.</b>
+		///
+		inline SplitRange Split(const char c, SplitOptions options = SplitOptions::None, size_t maxSplits = SIZE_MAX) const { return this->View().Split(c, options, maxSplits); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::String at each occurance of a sequence of characters without copying.
+		/// @param[in] text The delimiter. If it is empty, the Power::String is not split.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::String.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note <b>The parts are invalidated by any modification of the Power::String.</b>
+		///
+		inline SplitRange Split(const StringView& text, SplitOptions options = SplitOptions::None, size_t maxSplits = SIZE_MAX) const { return this->View().Split(text, options, maxSplits); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::String at each occurance of another Power::String without copying.
+		/// @param[in] text The delimiter. If it is empty, the Power::String is not split.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::String.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note <b>The parts are invalidated by any modification of the Power::String.</b>
+		///
+		inline SplitRange Split(const String& text, SplitOptions options = SplitOptions::None, size_t maxSplits = SIZE_MAX) const { return this->View().Split(text.View(), options, maxSplits); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::String at each occurance of a c-string without copying.
+		/// @param[in] text The delimiter. If it is empty, the Power::String is not split.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::String.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note <b>The parts are invalidated by any modification of the Power::String.</b>
+		///
+		inline SplitRange Split(const char* const text, SplitOptions options = SplitOptions::None, size_t maxSplits = SIZE_MAX) const { return this->View().Split(StringView(text), options, maxSplits); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::String at each character which is part of a Power::CharSet without copying.
+		/// @param[in] set The Power::CharSet with the delimiters, e.g. CharSet::Whitespace().
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::String.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note <b>The parts are invalidated by any modification of the Power::String.</b>
+		///
+		inline SplitRange Split(const CharSet& set, SplitOptions options = SplitOptions::None, size_t maxSplits = SIZE_MAX) const { return this->View().Split(set, options, maxSplits); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Lines-->
+		/// @brief Splits the Power::String into lines ending with LF or CRLF without copying.
+		/// @return A lazy LineRange of Power::StringViews without the line endings. A final line ending doesn't start another empty line.
+		/// @note <b>The lines are invalidated by any modification of the Power::String.</b>
+		///
+		inline LineRange Lines() const { return this->View().Lines(); }
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Insert-->
 		/// @brief Inserts the specified Power::String at the specified index.
 		/// @param[in] index The index where the specified Power::String will be inserted at.
@@ -1595,6 +2069,7 @@ namespace Power {
 			memcpy(temp_, data_, index);
 			memcpy(temp_ + index, data_ + index + count, size_ - index - count);
 			size_ = size_ - count;
+			this->InvalidateCodePointIndex();
 			memcpy(data_, temp_, size_);
 			data_[size_] = '\0';
 			return *this;
@@ -1620,6 +2095,7 @@ namespace Power {
 			}
 			memcpy(temp, data_ + index, size_ - index);
 			size_ = size_ - i * other.size_;
+			this->InvalidateCodePointIndex();
 			memcpy(data_, temp_, size_);
 			data_[size_] = '\0';
 			return *this;
@@ -1656,6 +2132,7 @@ namespace Power {
 			}
 			memcpy(temp, data_ + index, size_ - index);
 			size_ = size_ - i * size;
+			this->InvalidateCodePointIndex();
 			memcpy(data_, temp_, size_);
 			data_[size_] = '\0';
 			return *this;
@@ -1815,6 +2292,7 @@ namespace Power {
 			this->CheckCapacityAndReallocate(newSize);
 			this->MemCpyCheckData(index, other.data_, other.size_);
 			if (newSize > size_) this->SetNewSize(newSize);
+			else this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -1849,6 +2327,7 @@ namespace Power {
 			} else
 				memcpy(data_ + index, other, size);
 			if (newSize > size_) this->SetNewSize(newSize);
+			else this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -1862,6 +2341,7 @@ namespace Power {
 		inline String& ReplaceAt(size_t index, const char c) {
 			if (index >= size_) return *this;
 			data_[index] = c;
+			this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -1886,6 +2366,18 @@ namespace Power {
 			return *this;
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Removes all leading and trailing characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A reference to the current Power::String.
+		/// @note <b>To trim without moving any characters, use View().Trim(const CharSet&) const instead.</b>
+		///
+		inline String& Trim(const CharSet& set) {
+			this->TrimEnd(set);
+			this->TrimStart(set);
+			return *this;
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TrimStart-->
 		/// @brief Removes all leading whitespaces.
 		/// @return A reference to the current Power::String.
@@ -1899,16 +2391,18 @@ namespace Power {
 		///
 		inline String& TrimStart(const char c) {
 			size_t startIndex = 0;
-			for (size_t i = 0; i <= size_; ++i) {
-				if (data_[i] != c) {
-					startIndex = i;
-					break;
-				}
-			}
-			size_ = size_ - startIndex;
-			memcpy(temp_, data_ + startIndex, size_);
-			memcpy(data_, temp_, size_);
-			data_[size_] = '\0';
+			while (startIndex < size_ && data_[startIndex] == c) ++startIndex;
+			this->RemoveFront(startIndex);
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Removes all leading characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A reference to the current Power::String.
+		///
+		inline String& TrimStart(const CharSet& set) {
+			this->RemoveFront(Simd::SkipCharSet(set, data_, size_));
 			return *this;
 		}
 
@@ -1936,6 +2430,16 @@ namespace Power {
 			return *this;
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Removes all trailing characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A reference to the current Power::String.
+		///
+		inline String& TrimEnd(const CharSet& set) {
+			this->SetNewSize(Simd::SkipCharSetBackward(set, data_, size_));
+			return *this;
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PadLeft-->
 		/// @brief Right-aligns the Power::String by filling it to the left with whitespaces to the specified total size.
 		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
@@ -1954,13 +2458,54 @@ namespace Power {
 		inline String& PadLeft(size_t size, char c) {
 			if (size_ >= size) return *this;
 			this->CheckCapacityAndReallocate(size);
-			memset(temp_, c, size - size_);
-			memcpy(temp_ + size - size_, data_, size_);
-			memcpy(data_, temp_, size);
+			memmove(data_ + size - size_, data_, size_);
+			memset(data_, c, size - size_);
 			this->SetNewSize(size);
 			return *this;
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Right-aligns the Power::String by filling it to the left with repetitions of the specified Power::String to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The Power::String with which to fill. The last repetition is cut off where the current content begins.
+		/// \n If the Power::String is empty, this method will return without padding.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& PadLeft(size_t size, const String& pattern) { return this->PadLeft(size, pattern.data_, pattern.size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Right-aligns the Power::String by filling it to the left with repetitions of the specified c-string to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The c-string with which to fill. The last repetition is cut off where the current content begins.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use PadLeft(size_t, char) instead.
+		/// @return A reference to the current Power::String.
+		/// @note <b>If the size of the c-string is already known, it is recommended to use PadLeft(size_t, const char* const, size_t) instead as it is faster.</b>
+		///
+		inline String& PadLeft(size_t size, const char* const pattern) { return this->PadLeft(size, pattern, strlen(pattern)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Right-aligns the Power::String by filling it to the left with repetitions of the specified c-string to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The c-string with which to fill. The last repetition is cut off where the current content begins.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use PadLeft(size_t, char) instead.
+		/// @param[in] patternSize The size of the c-string excluding the null character.
+		/// \n If this value is 0, this method will return without padding.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& PadLeft(size_t size, const char* const pattern, size_t patternSize) {
+			if (size_ >= size || patternSize == 0) return *this;
+			int64_t offset = pattern - data_;
+			bool patternInSelf = this->PointerToSelf(offset);
+			size_t padding = size - size_;
+			this->CheckCapacityAndReallocate(size);
+			memmove(data_ + padding, data_, size_);
+			this->SetNewSize(size);
+			return this->Fill(patternSize, patternInSelf ? data_ + padding + offset : pattern, 0, padding);
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--PadRight-->
 		/// @brief Left-aligns the Power::String by filling it to the right with whitespaces to the specified total size.
 		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
@@ -1984,6 +2529,47 @@ namespace Power {
 			return *this;
 		}
 
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Left-aligns the Power::String by filling it to the right with repetitions of the specified Power::String to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The Power::String with which to fill. The last repetition is cut off at the end.
+		/// \n If the Power::String is empty, this method will return without padding.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& PadRight(size_t size, const String& pattern) { return this->PadRight(size, pattern.data_, pattern.size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Left-aligns the Power::String by filling it to the right with repetitions of the specified c-string to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The c-string with which to fill. The last repetition is cut off at the end.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use PadRight(size_t, char) instead.
+		/// @return A reference to the current Power::String.
+		/// @note <b>If the size of the c-string is already known, it is recommended to use PadRight(size_t, const char* const, size_t) instead as it is faster.</b>
+		///
+		inline String& PadRight(size_t size, const char* const pattern) { return this->PadRight(size, pattern, strlen(pattern)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Left-aligns the Power::String by filling it to the right with repetitions of the specified c-string to the specified total size.
+		/// @param[in] size The total size the Power::String should be including the current size of the Power::String.
+		/// \n If this value is less or equal to the size of the Power::String, this method will return without padding.
+		/// @param[in] pattern The c-string with which to fill. The last repetition is cut off at the end.
+		/// \n <span style="color:#FF0000"><b>Warning</b></span>: If a pointer to a char variable is passed, the behaviour is undefined. Use PadRight(size_t, char) instead.
+		/// @param[in] patternSize The size of the c-string excluding the null character.
+		/// \n If this value is 0, this method will return without padding.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& PadRight(size_t size, const char* const pattern, size_t patternSize) {
+			if (size_ >= size || patternSize == 0) return *this;
+			int64_t offset = pattern - data_;
+			bool patternInSelf = this->PointerToSelf(offset);
+			size_t oldSize = size_;
+			this->CheckCapacityAndReallocate(size);
+			this->SetNewSize(size);
+			return this->Fill(patternSize, patternInSelf ? data_ + offset : pattern, oldSize, size);
+		}
+
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--StartsWith-->
 		/// @brief Checks if the Power::String starts with the specified Power::String.
 		/// @param[in] other The Power::String to check for.
@@ -2094,22 +2680,7 @@ namespace Power {
 		/// \n This index is clamped to the size of the Power::String.
 		/// @return A reference to the current Power::String.
 		///
-		inline String& Fill(const String& other, size_t begin, size_t end) {
-			if (end > size_) end = size_;
-			if (begin >= end || other.size_ == 0) return *this;
-			size_t range = end - begin;
-			size_t count = range / other.size_;
-			int64_t offset = other.data_ - data_;
-			if (this->PointerToSelf(offset)) {
-				for (size_t i = 0; i < count; ++i) memcpy(temp_ + i * other.size_, other.data_, other.size_);
-				memcpy(temp_ + count * other.size_, other.data_, range % other.size_);
-				memcpy(data_ + begin, temp_, range);
-			} else {
-				for (size_t i = 0; i < count; ++i) memcpy(data_ + begin + i * other.size_, other.data_, other.size_);
-				memcpy(data_ + begin + count * other.size_, other.data_, range % other.size_);
-			}
-			return *this;
-		}
+		inline String& Fill(const String& other, size_t begin, size_t end) { return this->Fill(other.size_, other.data_, begin, end); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Fills the Power::String with the specified c-string.
@@ -2178,17 +2749,13 @@ namespace Power {
 		inline String& Fill(size_t size, const char* const other, size_t begin, size_t end) {
 			if (end > size_) end = size_;
 			if (begin >= end || size == 0) return *this;
-			size_t range = end - begin;
-			size_t count = range / size;
-			int64_t offset = other - data_;
-			if (this->PointerToSelf(offset)) {
-				for (size_t i = 0; i < count; ++i) memcpy(temp_ + i * size, other, size);
-				memcpy(temp_ + count * size, other, range % size);
-				memcpy(data_ + begin, temp_, range);
-			} else {
-				for (size_t i = 0; i < count; ++i) memcpy(data_ + begin + i * size, other, size);
-				memcpy(data_ + begin + count * size, other, range % size);
+			const char* pattern = other;
+			if (this->PointerToSelf(other - data_)) {
+				memcpy(temp_, other, size);
+				pattern = temp_;
 			}
+			Simd::FillPattern(data_ + begin, end - begin, pattern, size);
+			this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -2197,7 +2764,11 @@ namespace Power {
 		/// @param[in] c The character to fill with.
 		/// @return A reference to the current Power::String.
 		///
-		inline String& Fill(const char c) { memset(data_, c, size_); return *this; }
+		inline String& Fill(const char c) {
+			memset(data_, c, size_);
+			this->InvalidateCodePointIndex();
+			return *this;
+		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 		/// @brief Fills the Power::String with the specified character starting from the specified index.
@@ -2209,6 +2780,7 @@ namespace Power {
 		inline String& Fill(const char c, size_t begin) {
 			if (begin >= size_) return *this;
 			memset(data_ + begin, c, size_ - begin);
+			this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -2225,6 +2797,7 @@ namespace Power {
 			if (end > size_) end = size_;
 			if (begin >= end) return *this;
 			memset(data_ + begin, c, end - begin);
+			this->InvalidateCodePointIndex();
 			return *this;
 		}
 
@@ -2245,55 +2818,316 @@ namespace Power {
 		/// @brief Converts all upper case characters to lower case.
 		/// @return A reference to the current Power::String.
 		///
-		inline String& ToLower() { _strlwr_s(data_, size_ + 1); return *this; }
+		inline String& ToLower() {
+			_strlwr_s(data_, size_ + 1);
+			this->InvalidateCodePointIndex();
+			return *this;
+		}
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToUpper-->
 		/// @brief Converts all lower case characters to upper case.
 		/// @return A reference to the current Power::String.
 		///
-		inline String& ToUpper() { _strupr_s(data_, size_ + 1); return *this; }
+		inline String& ToUpper() {
+			_strupr_s(data_, size_ + 1);
+			this->InvalidateCodePointIndex();
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Translate-->
+		/// @brief Replaces every character with its entry in the specified translation table.
+		/// @param[in] table A pointer to 256 characters. The character c is replaced with table[(unsigned char)c].
+		/// \n Use CreateTranslationTable(char* const, const char* const, const char* const) to build tr-style tables.
+		/// @return A reference to the current Power::String.
+		/// @note Tables which only change the characters of a few 16-character rows (e.g. ASCII letters, separators or digits) are applied with SSSE3.
+		///
+		inline String& Translate(const char* const table) {
+			Simd::TranslateBytes(reinterpret_cast<const uint8_t*>(table), data_, data_, size_);
+			this->InvalidateCodePointIndex();
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Removes all characters of the specified set and replaces every other character with its entry in the specified translation table.
+		/// @param[in] table A pointer to 256 characters. The character c is replaced with table[(unsigned char)c].
+		/// @param[in] deleteSet The characters to be removed. Characters are checked for removal before they are translated.
+		/// @return A reference to the current Power::String.
+		///
+		inline String& Translate(const char* const table, const CharSet& deleteSet) {
+			if (deleteSet.IsEmpty()) return this->Translate(table);
+			this->SetNewSize(this->TranslateAndDelete(table, deleteSet, data_));
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes the Power::String into the specified destination with every character replaced by its entry in the specified translation table.
+		/// @param[in] table A pointer to 256 characters. The character c is replaced with table[(unsigned char)c].
+		/// @param[out] destination The Power::String receiving the translated characters. Its previous content is overwritten.
+		///
+		inline void Translate(const char* const table, String& destination) const {
+			destination.CheckCapacityAndReallocate(size_);
+			Simd::TranslateBytes(reinterpret_cast<const uint8_t*>(table), data_, destination.data_, size_);
+			destination.SetNewSize(size_);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes the Power::String into the specified destination without the characters of the specified set and with every other character
+		/// replaced by its entry in the specified translation table.
+		/// @param[in] table A pointer to 256 characters. The character c is replaced with table[(unsigned char)c].
+		/// @param[in] deleteSet The characters to be removed. Characters are checked for removal before they are translated.
+		/// @param[out] destination The Power::String receiving the translated characters. Its previous content is overwritten.
+		///
+		inline void Translate(const char* const table, const CharSet& deleteSet, String& destination) const {
+			if (deleteSet.IsEmpty()) return this->Translate(table, destination);
+			destination.CheckCapacityAndReallocate(size_);
+			destination.SetNewSize(this->TranslateAndDelete(table, deleteSet, destination.data_));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CreateTranslationTable-->
+		/// @brief Fills a translation table for Translate(const char* const) which maps each character of from to the character at the same position in to.
+		/// All other characters are mapped to themselves.
+		/// @param[out] table A pointer to 256 characters which will be filled.
+		/// @param[in] from The characters to be replaced.
+		/// @param[in] to The replacement characters.
+		/// \n If to is shorter than from, the surplus characters of from are mapped to the last character of to, like tr does.
+		/// \n If to is empty, every character of from is mapped to itself, so the table changes nothing. Use a CharSet with
+		/// \n Translate(const char* const, const CharSet&) to delete characters.
+		///
+		inline static void CreateTranslationTable(char* const table, const char* const from, const char* const to) {
+			for (size_t i = 0; i < 256; ++i) table[i] = static_cast<char>(i);
+			size_t toSize = strlen(to);
+			if (toSize == 0) return;
+			for (size_t i = 0; from[i] != '\0'; ++i) table[static_cast<uint8_t>(from[i])] = i < toSize ? to[i] : to[toSize - 1];
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseInt-->
+		/// @brief Parses a signed integer value from the start of the Power::String, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::String must be a number.
+		/// @note Whitespaces and a plus sign are not skipped and the result doesn't depend on the locale.
+		///
+		inline NumberParse::ParseResult TryParseInt(int32_t& value) const { return NumberParse::ParseInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses a signed long long value from the start of the Power::String, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::String must be a number.
+		///
+		inline NumberParse::ParseResult TryParseInt(int64_t& value) const { return NumberParse::ParseInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseUInt-->
+		/// @brief Parses an unsigned integer value from the start of the Power::String, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::String must be a number.
+		///
+		inline NumberParse::ParseResult TryParseUInt(uint32_t& value) const { return NumberParse::ParseUInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses an unsigned long long value from the start of the Power::String, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::String must be a number.
+		///
+		inline NumberParse::ParseResult TryParseUInt(uint64_t& value) const { return NumberParse::ParseUInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseDouble-->
+		/// @brief Parses a double value from the start of the Power::String, like std::from_chars. The decimal point is always '.'.
+		/// @param[out] value The parsed value, correctly rounded. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::String must be a number.
+		///
+		inline NumberParse::ParseResult TryParseDouble(double& value) const { return NumberParse::ParseDouble(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToInt32-->
+		/// @brief Parses a signed integer value from the start of the Power::String.
+		/// @return The parsed value or 0, if the Power::String doesn't start with a number or it is out of range.
+		///
+		inline int32_t ToInt32() const {
+			int32_t value = 0;
+			this->TryParseInt(value);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToInt64-->
+		/// @brief Parses a signed long long value from the start of the Power::String.
+		/// @return The parsed value or 0, if the Power::String doesn't start with a number or it is out of range.
+		///
+		inline int64_t ToInt64() const {
+			int64_t value = 0;
+			this->TryParseInt(value);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToDouble-->
+		/// @brief Parses a double value from the start of the Power::String.
+		/// @return The parsed value or 0, if the Power::String doesn't start with a number or it is out of range.
+		///
+		inline double ToDouble() const {
+			double value = 0.0;
+			this->TryParseDouble(value);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsValidUtf8-->
+		/// @brief Checks if the Power::String contains valid UTF-8.
+		/// @return <span style="color:#30AA00">True</span>, if the Power::String contains valid UTF-8.
+		/// @return <span style="color:#CC3000">False</span>, if it contains overlong encodings, surrogates, code points above U+10FFFF or incomplete sequences.
+		/// @note The bytes are validated with lookup tables 16 at a time, ASCII 64 at a time.
+		///
+		inline bool IsValidUtf8() const { return Utf8::IsValid(data_, size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CodePointCount-->
+		/// @brief Gets the number of UTF-8 code points of the Power::String.
+		/// @return The number of code points. For invalid UTF-8, stray continuation bytes count towards the preceding code point.
+		/// @note The count is taken from the code point index, if it has been created by IndexCodePoints().
+		///
+		inline size_t CodePointCount() const {
+			if (codePointIndex_ != nullptr) return codePointIndex_->codePointCount;
+			return Utf8::CountCodePoints(data_, size_);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IndexCodePoints-->
+		/// @brief Creates a sparse index of every 128th code point, which makes CodePointToByteOffset(size_t) const cost a scan of at most 127 code points.
+		/// @return A reference to the current Power::String.
+		/// @note The index is kept until the Power::String is modified. It is only worth it for large Power::Strings which are accessed by code point often.
+		/// \n It is never created by the const methods, so they stay safe to be called from several threads at once.
+		///
+		inline String& IndexCodePoints() {
+			if (codePointIndex_ == nullptr) codePointIndex_ = Utf8::CreateCodePointIndex(data_, size_);
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CodePointToByteOffset-->
+		/// @brief Converts a UTF-8 code point index into a byte index of the Power::String.
+		/// @param[in] codePoint The index of the code point.
+		/// @return The index of the first byte of the code point or the size of the Power::String, if codePoint is greater or equal to the code point count.
+		/// @note Without an index created by IndexCodePoints(), the code points in front of codePoint are scanned.
+		///
+		inline size_t CodePointToByteOffset(size_t codePoint) const {
+			if (codePointIndex_ == nullptr) return Utf8::SkipCodePoints(data_, size_, codePoint);
+			return Utf8::CodePointToByteOffset(*codePointIndex_, data_, size_, codePoint);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SubstringByCodePoints-->
+		/// @brief Creates a substring from the specified start code point to the end of the Power::String.
+		/// @param[in] begin The index of the code point from where to start.
+		/// @return A Power::String containing the substring.
+		/// @return The returned Power::String will be empty, if the start index is greater than the code point count of the Power::String.
+		///
+		inline String SubstringByCodePoints(size_t begin) const { return this->Substring(this->CodePointToByteOffset(begin)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a substring from the specified start code point to the specified end code point.
+		/// @param[in] begin The index of the code point from where to start.
+		/// @param[in] end The index of the code point to where to stop.
+		/// @return A Power::String containing the substring.
+		/// @return The returned Power::String will be empty, if the start index is greater than the end index or the code point count of the Power::String.
+		///
+		inline String SubstringByCodePoints(size_t begin, size_t end) const {
+			if (begin > end) begin = end;
+			return this->Substring(this->CodePointToByteOffset(begin), this->CodePointToByteOffset(end));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Utf16Length-->
+		/// @brief Calculates the number of UTF-16 code units needed for the Power::String.
+		/// @return The exact number of UTF-16 code units, if the Power::String is valid UTF-8, and an upper bound of its valid part otherwise.
+		///
+		inline size_t Utf16Length() const { return Utf8::Utf16Length(data_, size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToUtf16-->
+		/// @brief Transcodes the Power::String from UTF-8 to UTF-16.
+		/// @param[out] destination The buffer receiving the UTF-16 code units. Must hold Utf16Length() const code units. No null character is written.
+		/// @return The number of written code units and the byte offset of the first invalid UTF-8 sequence, which is equal to the size, if there is none.
+		/// \n Transcoding stops in front of the first invalid sequence.
+		///
+		inline Utf8::TranscodeResult ToUtf16(char16_t* const destination) const { return Utf8::ToUtf16(data_, size_, destination); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToUtf32-->
+		/// @brief Transcodes the Power::String from UTF-8 to UTF-32.
+		/// @param[out] destination The buffer receiving the code points. Must hold CodePointCount() const code points. No null character is written.
+		/// @return The number of written code points and the byte offset of the first invalid UTF-8 sequence, which is equal to the size, if there is none.
+		/// \n Transcoding stops in front of the first invalid sequence.
+		///
+		inline Utf8::TranscodeResult ToUtf32(char32_t* const destination) const { return Utf8::ToUtf32(data_, size_, destination); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FoldCase-->
+		/// @brief Applies the Unicode simple case folding to the UTF-8 encoded Power::String, e.g. "STRAẞE" -> "straße", "ΣΊΣΥΦΟΣ" -> "σίσυφοσ".
+		/// @return A reference to the current Power::String.
+		/// @note Folded sequences can be one byte longer, so the capacity is checked once for 1.5 times the size. Invalid bytes are kept unchanged.
+		///
+		inline String& FoldCase() {
+			this->CheckCapacityAndReallocate(Utf8::FoldedLengthBound(size_));
+			size_t newSize = Utf8::FoldCase(data_, size_, temp_);
+			memcpy(data_, temp_, newSize);
+			this->SetNewSize(newSize);
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Applies the Unicode simple case folding to the UTF-8 encoded Power::String and writes the result into the specified Power::String.
+		/// @param[out] destination The Power::String receiving the folded characters. Its capacity is checked once, so reusing it avoids allocations.
+		///
+		inline void FoldCase(String& destination) const {
+			if (&destination == this) {
+				destination.FoldCase();
+				return;
+			}
+			destination.CheckCapacityAndReallocate(Utf8::FoldedLengthBound(size_));
+			destination.SetNewSize(Utf8::FoldCase(data_, size_, destination.data_));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--EqualsIgnoreCase-->
+		/// @brief Compares the current Power::String to the specified Power::String after applying the Unicode simple case folding to both.
+		/// @param[in] other The Power::String to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if both Power::Strings are equal after folding.
+		/// @return <span style="color:#CC3000">False</span>, if they aren't.
+		/// @note No memory is allocated, the code points are folded one at a time and ASCII 16 at a time.
+		///
+		inline bool EqualsIgnoreCase(const String& other) const { return Utf8::CompareFolded(data_, size_, other.data_, other.size_) == 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Compares the current Power::String to the specified c-string after applying the Unicode simple case folding to both.
+		/// @param[in] other The c-string to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if both are equal after folding.
+		/// @return <span style="color:#CC3000">False</span>, if they aren't.
+		///
+		inline bool EqualsIgnoreCase(const char* const other) const { return Utf8::CompareFolded(data_, size_, other, strlen(other)) == 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CompareIgnoreCase-->
+		/// @brief Compares the current Power::String to the specified Power::String by code points after applying the Unicode simple case folding to both.
+		/// @param[in] other The Power::String to be compared against.
+		/// @return 0, if both Power::Strings are equal after folding.
+		/// @return A negative value, if the current Power::String is ordered before the specified one.
+		/// @return A positive value, if it is ordered after it.
+		///
+		inline int CompareIgnoreCase(const String& other) const { return Utf8::CompareFolded(data_, size_, other.data_, other.size_); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Compares the current Power::String to the specified c-string by code points after applying the Unicode simple case folding to both.
+		/// @param[in] other The c-string to be compared against.
+		/// @return 0, if both are equal after folding.
+		/// @return A negative value, if the current Power::String is ordered before the c-string.
+		/// @return A positive value, if it is ordered after it.
+		///
+		inline int CompareIgnoreCase(const char* const other) const { return Utf8::CompareFolded(data_, size_, other, strlen(other)); }
 
 		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Destructor-->
 		/// @brief Frees all allocated memory of the Power::String.
 		///
 		~String() {
+			free(codePointIndex_);
 			free(data_);
 			--s_instanceCounter_;
 		}
 
 	private:
-		String(const String& lhs, const String& rhs) :
-			capacity_(lhs.size_ + rhs.size_ + 1),
-			size_(lhs.size_ + rhs.size_),
-			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
-		{
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, rhs.data_, rhs.size_);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const char* const rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			size_t rhsSize = strlen(rhs);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			this->IncInstCounter();
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, rhs, rhsSize);
-			data_[size_] = '\0';
-		}
+		// Reads files with io_uring directly into buffers of the file size.
+		friend class FileLoader;
+
 		String(const char* const lhs, const String& rhs) :
 			capacity_(0),
 			size_(0),
 			data_(nullptr),
-			temp_(nullptr)
+			temp_(nullptr),
+			codePointIndex_(nullptr)
 		{
 			size_t lhsSize = strlen(lhs);
 			size_ = rhs.size_ + lhsSize;
@@ -2305,187 +3139,39 @@ namespace Power {
 			memcpy(data_ + lhsSize, rhs.data_, rhs.size_);
 			data_[size_] = '\0';
 		}
-		String(const String& lhs, const char rhs) :
-			capacity_(lhs.size_ + 2),
-			size_(lhs.size_ + 1),
-			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
-		{
-			memcpy(data_, lhs.data_, lhs.size_);
-			data_[lhs.size_] = rhs;
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
 		String(const char lhs, const String& rhs) :
 			capacity_(rhs.size_ + 2),
 			size_(rhs.size_ + 1),
 			data_(static_cast<char*>(malloc(capacity_ * 2))),
-			temp_(data_ + capacity_)
+			temp_(data_ + capacity_),
+			codePointIndex_(nullptr)
 		{
 			data_[0] = lhs;
 			memcpy(data_ + 1, rhs.data_, rhs.size_);
 			data_[size_] = '\0';
 			this->IncInstCounter();
 		}
-		String(const String& lhs, const int16_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[INT16_MAX_CHR_COUNT];
-			snprintf(buffer, INT16_MAX_CHR_COUNT, "%hd", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const uint16_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[UINT16_MAX_CHR_COUNT];
-			snprintf(buffer, UINT16_MAX_CHR_COUNT, "%hu", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const int32_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[INT32_MAX_CHR_COUNT];
-			snprintf(buffer, INT32_MAX_CHR_COUNT, "%d", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const uint32_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[UINT32_MAX_CHR_COUNT];
-			snprintf(buffer, UINT32_MAX_CHR_COUNT, "%u", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const int64_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[INT64_MAX_CHR_COUNT];
-			snprintf(buffer, INT64_MAX_CHR_COUNT, "%lld", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const uint64_t rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[UINT64_MAX_CHR_COUNT];
-			snprintf(buffer, UINT64_MAX_CHR_COUNT, "%llu", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const float rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[FLOAT_MAX_CHR_COUNT];
-			snprintf(buffer, FLOAT_MAX_CHR_COUNT, "%g", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
-		String(const String& lhs, const double rhs) :
-			capacity_(0),
-			size_(0),
-			data_(nullptr),
-			temp_(nullptr)
-		{
-			char buffer[DOUBLE_MAX_CHR_COUNT];
-			snprintf(buffer, DOUBLE_MAX_CHR_COUNT, "%g", rhs);
-			size_t rhsSize = strlen(buffer);
-			size_ = lhs.size_ + rhsSize;
-			capacity_ = size_ + 1;
-			data_ = static_cast<char*>(malloc(capacity_ * 2));
-			temp_ = data_ + capacity_;
-			memcpy(data_, lhs.data_, lhs.size_);
-			memcpy(data_ + lhs.size_, buffer, rhsSize);
-			data_[size_] = '\0';
-			this->IncInstCounter();
-		}
 		String(FILE* fp, const char* const filePath) :
 			capacity_(0),
 			size_(0),
 			data_(nullptr),
-			temp_(nullptr)
+			temp_(nullptr),
+			codePointIndex_(nullptr)
 		{
 			if (!fopen_s(&fp, filePath, "r")) {
 				fseek(fp, 0, SEEK_END);
-				size_ = ftell(fp);
+#ifdef _MSC_VER
+				size_ = static_cast<size_t>(_ftelli64(fp));
+#else
+				size_ = static_cast<size_t>(ftello(fp));
+#endif
 				capacity_ = size_ + s_defaultCapacity;
 				fseek(fp, 0, 0);
 				data_ = static_cast<char*>(malloc(capacity_ * 2));
 				this->IncInstCounter();
 				temp_ = data_ + capacity_;
-				fread_s(data_, size_, 1, size_, fp);
+				// In text mode CRLF is read as LF, so less characters than the size of the file may be read.
+				size_ = fread_s(data_, size_, 1, size_, fp);
 				fclose(fp);
 				data_[size_] = '\0';
 			}
@@ -2499,6 +3185,44 @@ namespace Power {
 		inline void SetNewSize(size_t newSize) {
 			data_[newSize] = '\0';
 			size_ = newSize;
+			this->InvalidateCodePointIndex();
+		}
+
+		inline void InvalidateCodePointIndex() {
+			if (codePointIndex_ == nullptr) return;
+			free(codePointIndex_);
+			codePointIndex_ = nullptr;
+		}
+
+		inline String& ConcatenateDecimal(const NumberFormat::Decimal& decimal, NumberFormat::FloatStyle style) {
+			size_t otherSize = NumberFormat::DecimalLength(decimal, style);
+			size_t newSize = size_ + otherSize;
+			this->CheckCapacityAndReallocate(newSize);
+			NumberFormat::WriteDecimal(decimal, style, data_ + size_);
+			this->SetNewSize(newSize);
+			return *this;
+		}
+
+		inline String& ConcatenatePrecise(double value, NumberFormat::FloatStyle style, int32_t precision) {
+			this->CheckCapacityAndReallocate(size_ + NumberFormat::MaxLength(value, style, precision));
+			this->SetNewSize(size_ + NumberFormat::FormatPrecise(value, style, precision, data_ + size_));
+			return *this;
+		}
+
+		inline void RemoveFront(size_t count) {
+			if (count == 0) return;
+			memmove(data_, data_ + count, size_ - count);
+			this->SetNewSize(size_ - count);
+		}
+
+		// Replaces the buffer with one of exactly the specified capacity without keeping its characters.
+		inline void Reallocate(size_t capacity) {
+			free(data_);
+			capacity_ = capacity;
+			data_ = static_cast<char*>(malloc(capacity_ * 2));
+			temp_ = data_ + capacity_;
+			size_ = 0;
+			data_[0] = '\0';
 		}
 
 		inline void CheckCapacityAndReallocate(size_t newSize) {
@@ -2508,6 +3232,121 @@ namespace Power {
 			temp_ = data_ + capacity_;
 		}
 
+		// An element of Join with its position in the merged string. The seperator follows directly behind the element.
+		struct JoinPart {
+			const char* data;
+			size_t size;
+			size_t offset;
+		};
+
+		static inline StringView JoinElement(const String& element) { return StringView(element.data_, element.size_); }
+		static inline StringView JoinElement(const StringView& element) { return element; }
+		static inline StringView JoinElement(const char* const element) { return StringView(element, strlen(element)); }
+
+		template<typename Iterator>
+		static String JoinRange(const char* const space, size_t spaceSize, Iterator first, Iterator last) {
+			// The sizes of Power::Strings and Power::StringViews are known, so they are only cached for copying with multiple threads.
+			const bool cacheSizes = std::is_convertible<decltype(*first), const char*>::value;
+			JoinPart localParts[32];
+			JoinPart* parts = localParts;
+			size_t count = 0;
+			size_t totalSize = 0;
+			if (cacheSizes) totalSize = CollectJoinParts(first, last, spaceSize, localParts, parts, count);
+			else {
+				for (Iterator element = first; element != last; ++element, ++count) totalSize += JoinElement(*element).Size();
+				if (count > 0) totalSize += (count - 1) * spaceSize;
+				if (totalSize >= s_parallelJoinSize) CollectJoinParts(first, last, spaceSize, localParts, parts, count);
+			}
+
+			String newString = String(totalSize + s_defaultCapacity - 1);
+			if (cacheSizes || totalSize >= s_parallelJoinSize) JoinParts(space, spaceSize, parts, count, totalSize, newString.data_);
+			else {
+				char* data = newString.data_;
+				for (size_t i = 0; first != last; ++first, ++i) {
+					if (i > 0) {
+						memcpy(data, space, spaceSize);
+						data += spaceSize;
+					}
+					StringView element = JoinElement(*first);
+					memcpy(data, element.Data(), element.Size());
+					data += element.Size();
+				}
+			}
+			newString.SetNewSize(totalSize);
+			if (parts != localParts) free(parts);
+			return newString;
+		}
+
+		// Measures each element once and stores it with its position. Returns the size of the merged string.
+		template<typename Iterator>
+		static size_t CollectJoinParts(Iterator first, Iterator last, size_t spaceSize, JoinPart* const localParts, JoinPart*& parts, size_t& count) {
+			size_t partCapacity = 32;
+			size_t totalSize = 0;
+			count = 0;
+			for (; first != last; ++first) {
+				if (count == partCapacity) {
+					partCapacity *= 2;
+					JoinPart* newParts = static_cast<JoinPart*>(malloc(partCapacity * sizeof(JoinPart)));
+					memcpy(newParts, parts, count * sizeof(JoinPart));
+					if (parts != localParts) free(parts);
+					parts = newParts;
+				}
+				StringView element = JoinElement(*first);
+				if (count > 0) totalSize += spaceSize;
+				parts[count].data = element.Data();
+				parts[count].size = element.Size();
+				parts[count].offset = totalSize;
+				totalSize += element.Size();
+				++count;
+			}
+			return totalSize;
+		}
+
+		static inline void JoinParts(const char* const space, size_t spaceSize, const JoinPart* const parts, size_t count, size_t totalSize, char* const destination) {
+			size_t threadCount = totalSize >= s_parallelJoinSize ? std::thread::hardware_concurrency() : 1;
+			if (threadCount > 16) threadCount = 16;
+			if (threadCount > 1) {
+				std::thread threads[16];
+				for (size_t i = 1; i < threadCount; ++i) {
+					threads[i] = std::thread(CopyJoinedRange, space, spaceSize, parts, count, destination, totalSize / threadCount * i, i + 1 < threadCount ? totalSize / threadCount * (i + 1) : totalSize);
+				}
+				CopyJoinedRange(space, spaceSize, parts, count, destination, 0, totalSize / threadCount);
+				for (size_t i = 1; i < threadCount; ++i) threads[i].join();
+				return;
+			}
+
+			char* data = destination;
+			for (size_t i = 0; i < count; ++i) {
+				if (i > 0) {
+					memcpy(data, space, spaceSize);
+					data += spaceSize;
+				}
+				memcpy(data, parts[i].data, parts[i].size);
+				data += parts[i].size;
+			}
+		}
+
+		// Copies the characters of the merged string from begin to end. The first element is found by a binary search over the offsets.
+		static inline void CopyJoinedRange(const char* const space, size_t spaceSize, const JoinPart* const parts, size_t count, char* const destination, size_t begin, size_t end) {
+			size_t low = 0;
+			size_t high = count;
+			while (low + 1 < high) {
+				size_t middle = (low + high) / 2;
+				if (parts[middle].offset <= begin) low = middle;
+				else high = middle;
+			}
+			for (size_t i = low; i < count && parts[i].offset < end; ++i) {
+				CopyClipped(parts[i].data, parts[i].size, parts[i].offset, destination, begin, end);
+				if (i + 1 < count) CopyClipped(space, spaceSize, parts[i].offset + parts[i].size, destination, begin, end);
+			}
+		}
+
+		static inline void CopyClipped(const char* const source, size_t size, size_t offset, char* const destination, size_t begin, size_t end) {
+			size_t from = offset > begin ? offset : begin;
+			size_t to = offset + size < end ? offset + size : end;
+			if (from < to) memcpy(destination + from, source + (from - offset), to - from);
+		}
+
 		inline bool PointerToSelf(int64_t offset) const { return offset >= 0 && offset < static_cast<int64_t>(size_); }
 
 		inline void MemCpyCheckData(size_t index, const char* source, size_t size) const {
@@ -2519,8 +3358,19 @@ namespace Power {
 			}
 		}
 
+		inline size_t TranslateAndDelete(const char* const table, const CharSet& deleteSet, char* destination) const {
+			size_t count = 0;
+			for (size_t i = 0; i < size_; ++i) {
+				char c = data_[i];
+				destination[count] = table[static_cast<uint8_t>(c)];
+				count += !deleteSet.Contains(c);
+			}
+			return count;
+		}
+
 	public:
 		static size_t s_defaultCapacity;			///< Default capacity of the string.
+		static size_t s_parallelJoinSize;			///< Minimum size of a merged string to be copied by multiple threads in Join.
 		static size_t s_instanceCounter_;			///< Current count of instances.
 		static size_t s_totalInstancesCreated_;		///< Total amount of created instances.
 
@@ -2529,5 +3379,18 @@ namespace Power {
 		size_t size_;
 		char* data_;
 		char* temp_;
+		Utf8::CodePointIndex* codePointIndex_;
 	};
+
+	inline Formatting::FormatArgument::FormatArgument(const String& string) : kind_(Kind::Text), size_(string.Size()) { text_ = string.CString(); }
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Format-->
+	/// @brief Formats arguments according to a format string which is parsed and validated at compile time, e.g.
+	/// \n Power::Format(POWER_FORMAT("{}: {} items in {:.3f}s"), name, count, seconds).
+	/// @param[in] format The format string, wrapped with POWER_FORMAT. See String::Format(FormatString, const Args&...) for the fields.
+	/// @param[in] args The arguments, one per field.
+	/// @return A Power::String containing the formatted characters.
+	///
+	template<typename FormatString, typename... Args>
+	inline String Format(FormatString format, const Args&... args) { return String::Format(format, args...); }
 }
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+
+#include "PowerFile.h"
+#include "PowerFormat.h"
+#include "PowerString.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief Builds a large string in a list of chunks, which grow geometrically and are never moved once written.
+	/// @brief Unlike Power::String::Concatenate, growing never copies what was appended before.
+	/// @brief The chunks are either copied once into an exact-size Power::String with Build(), or written out with WriteTo() without a contiguous copy.
+	///
+	class StringBuilder {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes a new empty Power::StringBuilder.
+		/// @param[in] capacity The capacity of the first chunk. Every further chunk is twice as large as the previous one, or as large as needed.
+		///
+		explicit StringBuilder(size_t capacity = String::s_defaultCapacity) : head_(nullptr), tail_(nullptr), size_(0) {
+			head_ = tail_ = NewChunk(capacity > 0 ? capacity : 1);
+		}
+
+		StringBuilder(const StringBuilder&) = delete;
+		StringBuilder& operator=(const StringBuilder&) = delete;
+
+		~StringBuilder() {
+			while (head_ != nullptr) {
+				Chunk* next = head_->next;
+				free(head_);
+				head_ = next;
+			}
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Append-->
+		/// @brief Appends characters. They are split across the free space of the last chunk and a new one, if they don't fit.
+		/// @param[in] data The characters to be appended.
+		/// @param[in] size The number of characters.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		inline StringBuilder& Append(const char* data, size_t size) {
+			size_ += size;
+			if (size <= tail_->capacity - tail_->size) {
+				memcpy(tail_->Data() + tail_->size, data, size);
+				tail_->size += size;
+				return *this;
+			}
+			while (size > 0) {
+				size_t space = tail_->capacity - tail_->size;
+				if (space == 0) {
+					this->AddChunk(size);
+					space = tail_->capacity;
+				}
+				size_t count = size < space ? size : space;
+				memcpy(tail_->Data() + tail_->size, data, count);
+				tail_->size += count;
+				data += count;
+				size -= count;
+			}
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Appends a c-string.
+		/// @param[in] cString The c-string to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		inline StringBuilder& Append(const char* const cString) { return this->Append(cString, strlen(cString)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Appends the characters of a Power::String.
+		/// @param[in] string The Power::String to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		inline StringBuilder& Append(const String& string) { return this->Append(string.CString(), string.Size()); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Appends the characters of a Power::StringView.
+		/// @param[in] view The Power::StringView to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		inline StringBuilder& Append(const StringView& view) { return this->Append(view.Data(), view.Size()); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Appends a character.
+		/// @param[in] c The character to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		inline StringBuilder& Append(const char c) {
+			if (tail_->size == tail_->capacity) this->AddChunk(1);
+			tail_->Data()[tail_->size++] = c;
+			++size_;
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Appends an integer or floating point value or a bool, written like by Power::String::Concat(const Args&...).
+		/// @param[in] value The value to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		/// @note The characters are written directly into the last chunk, or into a new one, if they don't fit.
+		///
+		template<typename T>
+		inline StringBuilder& Append(const T& value) {
+			Formatting::FormatArgument argument = Formatting::MakeArgument(value);
+			size_t size = argument.MaxLength(Formatting::FormatSpec());
+			if (tail_->capacity - tail_->size < size) this->AddChunk(size);
+			size = argument.Write(Formatting::FormatSpec(), tail_->Data() + tail_->size);
+			tail_->size += size;
+			size_ += size;
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--AppendAll-->
+		/// @brief Appends any number of operands.
+		/// @param[in] args Power::Strings, Power::StringViews, c-strings, characters, integer or floating point values and bools.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		template<typename... Args>
+		inline StringBuilder& AppendAll(const Args&... args) {
+			const int order[] = { 0, (this->Append(args), 0)... };
+			(void)order;
+			return *this;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Bitwise left shift operator-->
+		/// @brief Appends an operand, see Append().
+		/// @param[in] value The operand to be appended.
+		/// @return A reference to the current Power::StringBuilder.
+		///
+		template<typename T>
+		inline StringBuilder& operator<<(const T& value) { return this->Append(value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the number of appended characters.
+		/// @return The number of appended characters.
+		///
+		inline size_t Size() const { return size_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsEmpty-->
+		/// @brief Checks if the Power::StringBuilder is empty.
+		/// @return <span style="color:#30AA00">True</span>, if nothing was appended.
+		/// @return <span style="color:#CC3000">False</span>, if something was appended.
+		///
+		inline bool IsEmpty() const { return size_ == 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Clear-->
+		/// @brief Removes all characters. The first chunk is kept for reuse, the others are released.
+		///
+		inline void Clear() {
+			Chunk* chunk = head_->next;
+			while (chunk != nullptr) {
+				Chunk* next = chunk->next;
+				free(chunk);
+				chunk = next;
+			}
+			head_->next = nullptr;
+			head_->size = 0;
+			tail_ = head_;
+			size_ = 0;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Build-->
+		/// @brief Copies all chunks into one Power::String.
+		/// @return A Power::String containing all appended characters with the exact capacity.
+		///
+		inline String Build() const {
+			String result(size_);
+			for (const Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) result.Concatenate(chunk->Data(), chunk->size);
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--WriteTo-->
+		/// @brief Writes all chunks to a file stream one after another.
+		/// @param[in] file The file stream.
+		/// @return <span style="color:#30AA00">True</span>, if all characters were written.
+		/// @return <span style="color:#CC3000">False</span>, if writing failed.
+		///
+		inline bool WriteTo(FILE* file) const {
+			for (const Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) {
+				if (fwrite(chunk->Data(), 1, chunk->size, file) != chunk->size) return false;
+			}
+			return true;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Writes all chunks to a file descriptor one after another, bypassing the buffer of the C runtime.
+		/// @param[in] fd The file descriptor.
+		/// @return <span style="color:#30AA00">True</span>, if all characters were written.
+		/// @return <span style="color:#CC3000">False</span>, if writing failed.
+		///
+		inline bool WriteTo(int fd) const {
+			for (const Chunk* chunk = head_; chunk != nullptr; chunk = chunk->next) {
+				if (File::WriteToDescriptor(fd, chunk->Data(), chunk->size).error != File::FileError::None) return false;
+			}
+			return true;
+		}
+
+	private:
+		struct Chunk {
+			Chunk* next;
+			size_t capacity;
+			size_t size;
+
+			inline char* Data() { return reinterpret_cast<char*>(this + 1); }
+			inline const char* Data() const { return reinterpret_cast<const char*>(this + 1); }
+		};
+
+		static inline Chunk* NewChunk(size_t capacity) {
+			Chunk* chunk = static_cast<Chunk*>(malloc(sizeof(Chunk) + capacity));
+			chunk->next = nullptr;
+			chunk->capacity = capacity;
+			chunk->size = 0;
+			return chunk;
+		}
+
+		inline void AddChunk(size_t minimum) {
+			size_t capacity = tail_->capacity * 2;
+			tail_->next = NewChunk(capacity > minimum ? capacity : minimum);
+			tail_ = tail_->next;
+		}
+
+		Chunk* head_;
+		Chunk* tail_;
+		size_t size_;
+	};
+}
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <inttypes.h>
+#include <iterator>
+
+#include "PowerFile.h"
+#include "PowerMappedFile.h"
+#include "PowerSimd.h"
+#include "PowerString.h"
+#include "PowerStringView.h"
+
+
+namespace Power {
+	/// @brief The reason a Power::StringTable couldn't be opened.
+	///
+	enum class StringTableError {
+		None,					///< The table has been opened.
+		OpenFailed,				///< The file couldn't be opened or mapped.
+		InvalidFormat,			///< The data is not a table or is truncated.
+		UnsupportedVersion,		///< The table was written by a newer version.
+		ChecksumMismatch		///< The offsets or characters are corrupted.
+	};
+
+	/// @brief A list of strings stored in a binary file, which is read by mapping it, so opening it doesn't allocate or parse anything per string.
+	/// @brief The file consists of a header of 32 bytes, a table of count + 1 offsets and the characters of all strings one after another:
+	/// \n "PSTB", the version (16 bits), the flags (16 bits, bit 0: 64-bit offsets), the CRC-32C of the offsets and characters (32 bits),
+	/// \n 32 reserved bits, which must be 0, the number of strings (64 bits) and the number of characters (64 bits). All values are little-endian.
+	/// @brief The offsets are 32 bits wide, unless the characters are larger than 4GB. A string is the characters between its offset and the next one.
+	///
+	class StringTable {
+	public:
+		static const uint16_t s_version = 1;		///< The version of the format written by Write.
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes an empty Power::StringTable.
+		///
+		StringTable() : offsets_(nullptr), characters_(""), count_(0), wideOffsets_(false) {}
+
+		StringTable(const StringTable&) = delete;
+		StringTable& operator=(const StringTable&) = delete;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Write-->
+		/// @brief Writes a range of strings to a file in the format of a Power::StringTable.
+		/// @param[in] filePath The path of the file. It is created, if it doesn't exist.
+		/// @param[in] strings A range of Power::Strings, Power::StringViews or c-strings, e.g. a std::vector or an array.
+		/// \n It is iterated five times: to count, to checksum the offsets and the characters and to write both. c-strings are measured with strlen each time.
+		/// @param[in] options The File::SaveOptions. By default, the file is replaced atomically, so a reader never sees a partial table.
+		/// @return The File::FileResult with the number of bytes written.
+		/// @note The offsets are generated in small batches, so writing doesn't allocate memory per string.
+		///
+		template<typename Range>
+		static File::FileResult Write(const char* const filePath, const Range& strings, File::SaveOptions options = File::SaveOptions::AtomicReplace) {
+			uint64_t count = 0;
+			uint64_t dataSize = 0;
+			for (auto element = std::begin(strings); element != std::end(strings); ++element, ++count) dataSize += Element(*element).Size();
+			const bool wideOffsets = dataSize > UINT32_MAX;
+
+			uint32_t checksum = 0;
+			ForEachOffsetBatch(strings, wideOffsets, [&checksum](const char* batch, size_t size) {
+				checksum = Simd::Crc32c(checksum, batch, size);
+				return true;
+			});
+			for (auto element = std::begin(strings); element != std::end(strings); ++element) {
+				StringView view = Element(*element);
+				checksum = Simd::Crc32c(checksum, view.Data(), view.Size());
+			}
+
+			char header[s_headerSize];
+			WriteHeader(header, wideOffsets, checksum, count, dataSize);
+			File::FileWriter writer;
+			File::FileResult result = writer.Open(filePath, options);
+			if (result.error != File::FileError::None) return result;
+			result = writer.Append(header, s_headerSize);
+			if (result.error != File::FileError::None) return result;
+			ForEachOffsetBatch(strings, wideOffsets, [&writer, &result](const char* batch, size_t size) {
+				result = writer.Append(batch, size);
+				return result.error == File::FileError::None;
+			});
+			if (result.error != File::FileError::None) return result;
+			for (auto element = std::begin(strings); element != std::end(strings); ++element) {
+				StringView view = Element(*element);
+				result = writer.Append(view.Data(), view.Size());
+				if (result.error != File::FileError::None) return result;
+			}
+			return writer.Commit();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Open-->
+		/// @brief Maps a file written by Write. A table opened before is closed first.
+		/// @param[in] filePath The path of the file.
+		/// @param[in] verifyChecksum Whether the checksum and the offsets are verified, which reads the whole file.
+		/// \n Without it, opening only reads the header and the strings are read from the file when they are accessed first.
+		/// @return The StringTableError. The table is empty, if an error is returned.
+		/// @note <b>Only skip the verification for files which can be trusted, as corrupted offsets point outside of the table.</b>
+		///
+		inline StringTableError Open(const char* const filePath, bool verifyChecksum = true) {
+			this->Close();
+			if (!file_.Open(filePath, verifyChecksum ? MapOptions::Sequential : MapOptions::Random)) return StringTableError::OpenFailed;
+			StringTableError error = this->Open(file_.View(), verifyChecksum);
+			if (error != StringTableError::None) file_.Close();
+			return error;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Opens a table which is already in memory, e.g. loaded with Power::String::TryLoadFile. A table opened before is closed first.
+		/// @param[in] data The bytes of the table. They must outlive the Power::StringTable.
+		/// @param[in] verifyChecksum Whether the checksum and the offsets are verified.
+		/// @return The StringTableError. The table is empty, if an error is returned.
+		///
+		inline StringTableError Open(const StringView& data, bool verifyChecksum = true) {
+			if (data.Data() != file_.Data()) this->Close();
+			this->Reset();
+			if (data.Size() < s_headerSize || memcmp(data.Data(), "PSTB", 4) != 0) return StringTableError::InvalidFormat;
+			uint16_t version = Read16(data.Data() + 4);
+			uint16_t flags = Read16(data.Data() + 6);
+			if (version == 0 || Read32(data.Data() + 12) != 0) return StringTableError::InvalidFormat;
+			if (version > s_version || (flags & ~1) != 0) return StringTableError::UnsupportedVersion;
+			uint32_t checksum = Read32(data.Data() + 8);
+			uint64_t count = Read64(data.Data() + 16);
+			uint64_t dataSize = Read64(data.Data() + 24);
+			const bool wideOffsets = (flags & 1) != 0;
+			const uint64_t offsetWidth = wideOffsets ? 8 : 4;
+			const uint64_t available = data.Size() - s_headerSize;
+			if (count >= available / offsetWidth || (count + 1) * offsetWidth + dataSize != available) return StringTableError::InvalidFormat;
+
+			const char* offsets = data.Data() + s_headerSize;
+			const char* characters = offsets + (count + 1) * offsetWidth;
+			if (verifyChecksum) {
+				if (Simd::Crc32c(0, offsets, static_cast<size_t>(available)) != checksum) return StringTableError::ChecksumMismatch;
+				uint64_t previous = 0;
+				for (uint64_t i = 0; i <= count; ++i) {
+					uint64_t offset = wideOffsets ? Read64(offsets + i * 8) : Read32(offsets + i * 4);
+					if (offset < previous || offset > dataSize || (i == count && offset != dataSize)) return StringTableError::InvalidFormat;
+					previous = offset;
+				}
+			}
+			offsets_ = offsets;
+			characters_ = characters;
+			count_ = static_cast<size_t>(count);
+			wideOffsets_ = wideOffsets;
+			return StringTableError::None;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Close-->
+		/// @brief Closes the table. The Power::StringViews of its strings are invalidated.
+		///
+		inline void Close() {
+			file_.Close();
+			this->Reset();
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the number of strings.
+		/// @return The number of strings in the table.
+		///
+		inline size_t Size() const { return count_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Subscript operator-->
+		/// @brief Gets a string of the table without copying it.
+		/// @param i The index of the string.
+		/// @return A Power::StringView of the string. It is valid until the table is closed.
+		///
+		inline StringView operator[](size_t i) const {
+			uint64_t begin = wideOffsets_ ? Read64(offsets_ + i * 8) : Read32(offsets_ + i * 4);
+			uint64_t end = wideOffsets_ ? Read64(offsets_ + i * 8 + 8) : Read32(offsets_ + i * 4 + 4);
+			return StringView(characters_ + begin, static_cast<size_t>(end - begin));
+		}
+
+	private:
+		static const size_t s_headerSize = 32;
+
+		static inline StringView Element(const String& element) { return StringView(element.CString(), element.Size()); }
+		static inline StringView Element(const StringView& element) { return element; }
+		static inline StringView Element(const char* const element) { return StringView(element, strlen(element)); }
+
+		// The values are copied byte by byte, as the table may be at any address, e.g. inside of a Power::String.
+		static inline uint16_t Read16(const char* data) {
+			uint16_t value;
+			memcpy(&value, data, 2);
+			return value;
+		}
+
+		static inline uint32_t Read32(const char* data) {
+			uint32_t value;
+			memcpy(&value, data, 4);
+			return value;
+		}
+
+		static inline uint64_t Read64(const char* data) {
+			uint64_t value;
+			memcpy(&value, data, 8);
+			return value;
+		}
+
+		static inline void WriteHeader(char* header, bool wideOffsets, uint32_t checksum, uint64_t count, uint64_t dataSize) {
+			const uint16_t version = s_version;
+			const uint16_t flags = wideOffsets ? 1 : 0;
+			const uint32_t reserved = 0;
+			memcpy(header, "PSTB", 4);
+			memcpy(header + 4, &version, 2);
+			memcpy(header + 6, &flags, 2);
+			memcpy(header + 8, &checksum, 4);
+			memcpy(header + 12, &reserved, 4);
+			memcpy(header + 16, &count, 8);
+			memcpy(header + 24, &dataSize, 8);
+		}
+
+		// Passes the offsets of the strings and the end of the last one in batches of 2KB to the function, until it returns false.
+		template<typename Range, typename Function>
+		static void ForEachOffsetBatch(const Range& strings, bool wideOffsets, Function function) {
+			char batch[2048];
+			size_t size = 0;
+			uint64_t offset = 0;
+			const size_t width = wideOffsets ? 8 : 4;
+			for (auto element = std::begin(strings); element != std::end(strings); ++element) {
+				if (wideOffsets) memcpy(batch + size, &offset, 8);
+				else {
+					uint32_t narrowOffset = static_cast<uint32_t>(offset);
+					memcpy(batch + size, &narrowOffset, 4);
+				}
+				size += width;
+				offset += Element(*element).Size();
+				if (size == sizeof(batch)) {
+					if (!function(static_cast<const char*>(batch), size)) return;
+					size = 0;
+				}
+			}
+			if (wideOffsets) memcpy(batch + size, &offset, 8);
+			else {
+				uint32_t narrowOffset = static_cast<uint32_t>(offset);
+				memcpy(batch + size, &narrowOffset, 4);
+			}
+			function(static_cast<const char*>(batch), size + width);
+		}
+
+		inline void Reset() {
+			offsets_ = nullptr;
+			characters_ = "";
+			count_ = 0;
+			wideOffsets_ = false;
+		}
+
+		MappedFile file_;
+		const char* offsets_;
+		const char* characters_;
+		size_t count_;
+		bool wideOffsets_;
+	};
+}
@@ -0,0 +1,344 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <inttypes.h>
+
+#include "PowerCharSet.h"
+#include "PowerNumberParse.h"
+#include "PowerSimd.h"
+
+
+namespace Power {
+	class LineRange;
+	class SplitRange;
+	enum class SplitOptions : uint32_t;
+
+	/// @brief A read-only, non-owning view of a sequence of characters.
+	/// @brief A Power::StringView only stores a pointer and a size, so creating, copying and trimming it never copies or allocates.
+	/// @brief The viewed characters are not necessarily null-terminated and must outlive the Power::StringView.
+	///
+	class StringView {
+	public:
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Constructors-->
+		/// @brief Initializes an empty Power::StringView.
+		///
+		StringView() : data_(""), size_(0) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a Power::StringView of the specified c-string.
+		/// @param[in] cString The c-string to be viewed.
+		/// @note <b>If the size of the c-string is already known, it is recommended to use StringView(const char* const, size_t) instead as it is faster.</b>
+		///
+		StringView(const char* const cString) : data_(cString), size_(strlen(cString)) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Initializes a Power::StringView of the specified characters.
+		/// @param[in] data The characters to be viewed.
+		/// @param[in] size The number of characters to be viewed.
+		///
+		StringView(const char* const data, size_t size) : data_(data), size_(size) {}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Subscript operator-->
+		/// @brief Returns the character at the specified index.
+		/// @param i The index.
+		/// @return The character at the specified index.
+		///
+		inline char operator[](size_t i) const { return data_[i]; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Comparison equal operators-->
+		/// @brief Compares the current Power::StringView to the specified Power::StringView.
+		/// @param other The Power::StringView to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if both views contain the same characters.
+		/// @return <span style="color:#CC3000">False</span>, if they don't.
+		///
+		inline bool operator==(const StringView& other) const { return size_ == other.size_ && memcmp(data_, other.data_, size_) == 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Compares the current Power::StringView to the specified c-string.
+		/// @param other The c-string to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if the Power::StringView contains the characters of the c-string.
+		/// @return <span style="color:#CC3000">False</span>, if it doesn't.
+		///
+		inline bool operator==(const char* const other) const { return *this == StringView(other); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Comparison not equal operators-->
+		/// @brief Compares the current Power::StringView to the specified Power::StringView.
+		/// @param other The Power::StringView to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if the views contain different characters.
+		/// @return <span style="color:#CC3000">False</span>, if they don't.
+		///
+		inline bool operator!=(const StringView& other) const { return !(*this == other); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Compares the current Power::StringView to the specified c-string.
+		/// @param other The c-string to be compared against.
+		/// @return <span style="color:#30AA00">True</span>, if the Power::StringView doesn't contain the characters of the c-string.
+		/// @return <span style="color:#CC3000">False</span>, if it does.
+		///
+		inline bool operator!=(const char* const other) const { return !(*this == StringView(other)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Data-->
+		/// @brief Gets the first viewed character.
+		/// @return A pointer to the first viewed character. The characters are not necessarily null-terminated.
+		///
+		inline const char* Data() const { return data_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Size-->
+		/// @brief Gets the number of viewed characters.
+		/// @return The number of viewed characters.
+		///
+		inline size_t Size() const { return size_; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsEmpty-->
+		/// @brief Checks if the Power::StringView is empty.
+		/// @return <span style="color:#30AA00">True</span>, if no characters are viewed.
+		/// @return <span style="color:#CC3000">False</span>, if there are.
+		///
+		inline bool IsEmpty() const { return size_ == 0; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Substring-->
+		/// @brief Creates a view from the specified start index to the end of the Power::StringView.
+		/// @param[in] begin The index from where to start.
+		/// @return A Power::StringView of the substring.
+		/// @return The returned Power::StringView will be empty, if the start index is greater than the size of the Power::StringView.
+		///
+		inline StringView Substring(size_t begin) const {
+			if (begin > size_) begin = size_;
+			return StringView(data_ + begin, size_ - begin);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view from the specified start index to the specified end index.
+		/// @param[in] begin The index from where to start.
+		/// @param[in] end The index to where to stop.
+		/// @return A Power::StringView of the substring.
+		/// @return The returned Power::StringView will be empty, if the start index is greater than the end index or the size of the Power::StringView.
+		///
+		inline StringView Substring(size_t begin, size_t end) const {
+			if (end > size_) end = size_;
+			if (begin > end) begin = end;
+			return StringView(data_ + begin, end - begin);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Trim-->
+		/// @brief Creates a view without the leading and trailing whitespaces.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView Trim() const { return this->Trim(' '); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the leading and trailing occurances of the specified character.
+		/// @param[in] c The character to be trimmed.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView Trim(const char c) const { return this->TrimEnd(c).TrimStart(c); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the leading and trailing characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView Trim(const CharSet& set) const { return this->TrimEnd(set).TrimStart(set); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TrimStart-->
+		/// @brief Creates a view without the leading whitespaces.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimStart() const { return this->TrimStart(' '); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the leading occurances of the specified character.
+		/// @param[in] c The character to be trimmed.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimStart(const char c) const {
+			size_t begin = 0;
+			while (begin < size_ && data_[begin] == c) ++begin;
+			return StringView(data_ + begin, size_ - begin);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the leading characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimStart(const CharSet& set) const {
+			size_t begin = Simd::SkipCharSet(set, data_, size_);
+			return StringView(data_ + begin, size_ - begin);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TrimEnd-->
+		/// @brief Creates a view without the trailing whitespaces.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimEnd() const { return this->TrimEnd(' '); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the trailing occurances of the specified character.
+		/// @param[in] c The character to be trimmed.
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimEnd(const char c) const {
+			size_t end = size_;
+			while (end > 0 && data_[end - 1] == c) --end;
+			return StringView(data_, end);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Creates a view without the trailing characters which are part of the specified Power::CharSet.
+		/// @param[in] set The Power::CharSet with the characters to be trimmed, e.g. CharSet::Whitespace().
+		/// @return A Power::StringView of the trimmed characters.
+		///
+		inline StringView TrimEnd(const CharSet& set) const { return StringView(data_, Simd::SkipCharSetBackward(set, data_, size_)); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IndexOf-->
+		/// @brief Finds the first occurance of a character.
+		/// @param[in] c The character to look for.
+		/// @param[in] begin The index from where to start looking.
+		/// @return The index of the first occurance of the character.
+		/// @return Or -1 if the character does not occur or if the begin index is greater or equal to the size of the Power::StringView.
+		/// @note The index is 64-bit, as a view may be larger than a Power::String, e.g. of a Power::MappedFile.
+		///
+		inline int64_t IndexOf(const char c, size_t begin = 0) const {
+			if (begin >= size_) return -1;
+			const char* p = static_cast<const char*>(memchr(data_ + begin, c, size_ - begin));
+			return p ? static_cast<int64_t>(p - data_) : -1;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Finds the first occurance of a sequence of characters.
+		/// @param[in] text The characters to look for.
+		/// @param[in] begin The index from where to start looking.
+		/// @return The start index of the first occurance of the characters. An empty text is found at the begin index.
+		/// @return Or -1 if the characters do not occur or if the begin index is greater than the size of the Power::StringView.
+		/// @note The index is 64-bit, as a view may be larger than a Power::String, e.g. of a Power::MappedFile.
+		///
+		inline int64_t IndexOf(const StringView& text, size_t begin = 0) const {
+			if (begin > size_) return -1;
+			if (text.size_ == 0) return static_cast<int64_t>(begin);
+			size_t index = Simd::FindText(data_ + begin, size_ - begin, text.data_, text.size_);
+			return index < size_ - begin ? static_cast<int64_t>(begin + index) : -1;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Count-->
+		/// @brief Counts how many times a character occurs, comparing 16 characters at a time.
+		/// @param[in] c The character to look for.
+		/// @return How many times the character occurs.
+		///
+		inline size_t Count(const char c) const {
+			size_t count = 0;
+			size_t i = 0;
+			for (; i + 16 <= size_; i += 16) count += Simd::PopCount(Simd::MatchChar(data_ + i, c));
+			for (; i < size_; ++i) count += data_[i] == c;
+			return count;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Split-->
+		/// @brief Splits the Power::StringView at each occurance of a character without copying.
+		/// @param[in] c The delimiter.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::StringView.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note Defined in PowerSplit.h.
+		///
+		inline SplitRange Split(const char c, SplitOptions options = SplitOptions(), size_t maxSplits = SIZE_MAX) const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::StringView at each occurance of a sequence of characters without copying.
+		/// @param[in] text The delimiter. If it is empty, the Power::StringView is not split.
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::StringView.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note Defined in PowerSplit.h.
+		///
+		inline SplitRange Split(const StringView& text, SplitOptions options = SplitOptions(), size_t maxSplits = SIZE_MAX) const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Splits the Power::StringView at each character which is part of a Power::CharSet without copying.
+		/// @param[in] set The Power::CharSet with the delimiters, e.g. CharSet::Whitespace().
+		/// @param[in] options The SplitOptions, e.g. SplitOptions::RemoveEmpty | SplitOptions::Trim.
+		/// @param[in] maxSplits The maximum number of delimiters to split at. The last part contains the rest of the Power::StringView.
+		/// @return A lazy SplitRange of Power::StringViews, which finds the next delimiter when its iterator is incremented.
+		/// @note Defined in PowerSplit.h.
+		///
+		inline SplitRange Split(const CharSet& set, SplitOptions options = SplitOptions(), size_t maxSplits = SIZE_MAX) const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Lines-->
+		/// @brief Splits the Power::StringView into lines ending with LF or CRLF without copying.
+		/// @return A lazy LineRange of Power::StringViews without the line endings.
+		/// @note Defined in PowerSplit.h.
+		///
+		inline LineRange Lines() const;
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseInt-->
+		/// @brief Parses a signed integer value from the start of the Power::StringView, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::StringView must be a number.
+		/// @note Whitespaces and a plus sign are not skipped and the result doesn't depend on the locale.
+		///
+		inline NumberParse::ParseResult TryParseInt(int32_t& value) const { return NumberParse::ParseInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses a signed long long value from the start of the Power::StringView, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::StringView must be a number.
+		///
+		inline NumberParse::ParseResult TryParseInt(int64_t& value) const { return NumberParse::ParseInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseUInt-->
+		/// @brief Parses an unsigned integer value from the start of the Power::StringView, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::StringView must be a number.
+		///
+		inline NumberParse::ParseResult TryParseUInt(uint32_t& value) const { return NumberParse::ParseUInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Parses an unsigned long long value from the start of the Power::StringView, like std::from_chars.
+		/// @param[out] value The parsed value. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::StringView must be a number.
+		///
+		inline NumberParse::ParseResult TryParseUInt(uint64_t& value) const { return NumberParse::ParseUInt(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TryParseDouble-->
+		/// @brief Parses a double value from the start of the Power::StringView, like std::from_chars. The decimal point is always '.'.
+		/// @param[out] value The parsed value, correctly rounded. Unchanged, if an error is returned.
+		/// @return The number of consumed characters and the NumberParse::ParseError. Check the consumed characters, if the whole Power::StringView must be a number.
+		///
+		inline NumberParse::ParseResult TryParseDouble(double& value) const { return NumberParse::ParseDouble(data_, size_, value); }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToInt32-->
+		/// @brief Parses a signed integer value from the start of the Power::StringView.
+		/// @return The parsed value or 0, if the Power::StringView doesn't start with a number or it is out of range.
+		///
+		inline int32_t ToInt32() const {
+			int32_t value = 0;
+			this->TryParseInt(value);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToInt64-->
+		/// @brief Parses a signed long long value from the start of the Power::StringView.
+		/// @return The parsed value or 0, if the Power::StringView doesn't start with a number or it is out of range.
+		///
+		inline int64_t ToInt64() const {
+			int64_t value = 0;
+			this->TryParseInt(value);
+			return value;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToDouble-->
+		/// @brief Parses a double value from the start of the Power::StringView.
+		/// @return The parsed value or 0, if the Power::StringView doesn't start with a number or it is out of range.
+		///
+		inline double ToDouble() const {
+			double value = 0.0;
+			this->TryParseDouble(value);
+			return value;
+		}
+
+	private:
+		const char* data_;
+		size_t size_;
+	};
+}
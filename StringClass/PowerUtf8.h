@@ -0,0 +1,742 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <inttypes.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#include "PowerCaseFoldTables.h"
+#include "PowerSimd.h"
+
+
+namespace Power {
+	namespace Utf8 {
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SequenceLength-->
+		/// @brief Checks the UTF-8 sequence starting with a non-ASCII lead byte.
+		/// @param[in] bytes The bytes of the sequence.
+		/// @param[in] remaining The number of bytes left in the buffer, at least 1.
+		/// @return The length of the sequence or 0, if it is invalid.
+		/// @note Overlong encodings, surrogates (U+D800 to U+DFFF), code points above U+10FFFF and sequences cut off by the end are invalid.
+		///
+		inline size_t SequenceLength(const uint8_t* bytes, size_t remaining) {
+			uint8_t lead = bytes[0];
+			size_t length;
+			uint8_t low = 0x80, high = 0xBF;
+			if (lead >= 0xC2 && lead <= 0xDF) length = 2;
+			else if (lead >= 0xE0 && lead <= 0xEF) {
+				length = 3;
+				if (lead == 0xE0) low = 0xA0;
+				else if (lead == 0xED) high = 0x9F;
+			} else if (lead >= 0xF0 && lead <= 0xF4) {
+				length = 4;
+				if (lead == 0xF0) low = 0x90;
+				else if (lead == 0xF4) high = 0x8F;
+			} else return 0;
+			if (remaining < length) return 0;
+			if (bytes[1] < low || bytes[1] > high) return 0;
+			for (size_t k = 2; k < length; ++k) {
+				if ((bytes[k] & 0xC0) != 0x80) return 0;
+			}
+			return length;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FindInvalid-->
+		/// @brief Finds the first byte which is not part of a valid UTF-8 sequence, one sequence at a time.
+		/// @param[in] data The bytes to be validated.
+		/// @param[in] size The number of bytes to be validated.
+		/// @return The offset of the first invalid sequence or size, if all bytes are valid UTF-8.
+		/// @note Overlong encodings, surrogates (U+D800 to U+DFFF), code points above U+10FFFF and sequences cut off by the end are invalid.
+		///
+		inline size_t FindInvalid(const char* const data, size_t size) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+			size_t i = 0;
+			while (i < size) {
+				if (i + 8 <= size) {
+					uint64_t block;
+					memcpy(&block, bytes + i, 8);
+					if ((block & 0x8080808080808080ull) == 0) {
+						i += 8;
+						continue;
+					}
+				}
+				if (bytes[i] < 0x80) {
+					++i;
+					continue;
+				}
+				size_t length = SequenceLength(bytes + i, size - i);
+				if (length == 0) return i;
+				i += length;
+			}
+			return size;
+		}
+
+		// Error bits of the lookup tables (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte").
+		// Each table maps a nibble to the errors it could be part of. An error is present, if all three nibbles agree on it.
+		const uint8_t kTooShort = 1 << 0;		///< A lead byte followed by a lead byte or ASCII.
+		const uint8_t kTooLong = 1 << 1;		///< ASCII followed by a continuation byte.
+		const uint8_t kOverlong3 = 1 << 2;		///< 0xE0 followed by 0x80-0x9F.
+		const uint8_t kTooLarge = 1 << 3;		///< 0xF4 followed by 0x90-0xBF or 0xF5-0xFF.
+		const uint8_t kSurrogate = 1 << 4;		///< 0xED followed by 0xA0-0xBF.
+		const uint8_t kOverlong2 = 1 << 5;		///< 0xC0 or 0xC1 as lead byte.
+		const uint8_t kTooLarge1000 = 1 << 6;	///< 0xF5-0xFF followed by 0x80-0x8F.
+		const uint8_t kOverlong4 = 1 << 6;		///< 0xF0 followed by 0x80-0x8F.
+		const uint8_t kTwoConts = 1 << 7;		///< Two continuation bytes, only valid as the 3rd or 4th byte of a sequence.
+		const uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+		/// @brief The state carried from one 16-byte block to the next by the vectorized validator.
+		///
+		struct BlockState {
+			__m128i error;
+			__m128i previous;
+			__m128i previousIncomplete;
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CheckBlock-->
+		/// @brief Validates 16 bytes against the last bytes of the previous block and accumulates the errors.
+		/// @param[in,out] state The state of the previous block.
+		/// @param[in] input The bytes to be validated.
+		///
+		POWER_TARGET_SSSE3 inline void CheckBlock(BlockState& state, __m128i input) {
+			const __m128i lowMask = _mm_set1_epi8(0x0F);
+			const __m128i byte1High = _mm_setr_epi8(
+				kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+				kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+				kTooShort | kOverlong2,
+				kTooShort,
+				kTooShort | kOverlong3 | kSurrogate,
+				static_cast<char>(kTooShort | kTooLarge | kTooLarge1000 | kOverlong4));
+			const __m128i byte1Low = _mm_setr_epi8(
+				static_cast<char>(kCarry | kOverlong3 | kOverlong2 | kOverlong4),
+				static_cast<char>(kCarry | kOverlong2),
+				static_cast<char>(kCarry),
+				static_cast<char>(kCarry),
+				static_cast<char>(kCarry | kTooLarge),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000 | kSurrogate),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000),
+				static_cast<char>(kCarry | kTooLarge | kTooLarge1000));
+			const __m128i byte2High = _mm_setr_epi8(
+				kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+				static_cast<char>(kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4),
+				static_cast<char>(kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge),
+				static_cast<char>(kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge),
+				static_cast<char>(kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge),
+				kTooShort, kTooShort, kTooShort, kTooShort);
+
+			__m128i previous1 = _mm_alignr_epi8(input, state.previous, 15);
+			__m128i special = _mm_and_si128(
+				_mm_and_si128(
+					_mm_shuffle_epi8(byte1High, _mm_and_si128(_mm_srli_epi16(previous1, 4), lowMask)),
+					_mm_shuffle_epi8(byte1Low, _mm_and_si128(previous1, lowMask))),
+				_mm_shuffle_epi8(byte2High, _mm_and_si128(_mm_srli_epi16(input, 4), lowMask)));
+			// Two continuation bytes in a row are only valid as the 3rd or 4th byte of a 3 or 4 byte sequence.
+			__m128i previous2 = _mm_alignr_epi8(input, state.previous, 14);
+			__m128i previous3 = _mm_alignr_epi8(input, state.previous, 13);
+			__m128i isThird = _mm_subs_epu8(previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+			__m128i isFourth = _mm_subs_epu8(previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+			__m128i must23 = _mm_and_si128(_mm_or_si128(isThird, isFourth), _mm_set1_epi8(static_cast<char>(0x80)));
+			state.error = _mm_or_si128(state.error, _mm_xor_si128(must23, special));
+
+			// A lead byte in the last three bytes needs continuation bytes from the next block.
+			const __m128i maxValue = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+				static_cast<char>(0xF0 - 1), static_cast<char>(0xE0 - 1), static_cast<char>(0xC0 - 1));
+			state.previousIncomplete = _mm_subs_epu8(input, maxValue);
+			state.previous = input;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--IsValid-->
+		/// @brief Validates UTF-8 with PSHUFB lookup tables, 16 bytes per block, skipping ASCII 64 bytes per iteration.
+		/// @param[in] data The bytes to be validated.
+		/// @param[in] size The number of bytes to be validated.
+		/// @return <span style="color:#30AA00">True</span>, if all bytes are valid UTF-8.
+		/// @return <span style="color:#CC3000">False</span>, if they aren't.
+		///
+		POWER_TARGET_SSSE3 inline bool IsValidSsse3(const char* const data, size_t size) {
+			BlockState state;
+			state.error = _mm_setzero_si128();
+			state.previous = _mm_setzero_si128();
+			state.previousIncomplete = _mm_setzero_si128();
+			size_t i = 0;
+			for (; i + 64 <= size; i += 64) {
+				__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 16));
+				__m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 32));
+				__m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 48));
+				if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d))) == 0) {
+					// Pure ASCII can only be wrong, if the previous block ended in the middle of a sequence.
+					state.error = _mm_or_si128(state.error, state.previousIncomplete);
+					state.previous = d;
+					state.previousIncomplete = _mm_setzero_si128();
+					continue;
+				}
+				CheckBlock(state, a);
+				CheckBlock(state, b);
+				CheckBlock(state, c);
+				CheckBlock(state, d);
+			}
+			for (; i + 16 <= size; i += 16) CheckBlock(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+			if (i < size) {
+				char tail[16] = { 0 };
+				memcpy(tail, data + i, size - i);
+				CheckBlock(state, _mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+			}
+			// The zeros behind the end act as ASCII, which flags any sequence cut off by the end as too short.
+			CheckBlock(state, _mm_setzero_si128());
+			return _mm_movemask_epi8(_mm_cmpeq_epi8(state.error, _mm_setzero_si128())) == 0xFFFF;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+		/// @brief Checks if the specified bytes are valid UTF-8.
+		/// @param[in] data The bytes to be validated.
+		/// @param[in] size The number of bytes to be validated.
+		/// @return <span style="color:#30AA00">True</span>, if all bytes are valid UTF-8.
+		/// @return <span style="color:#CC3000">False</span>, if they aren't.
+		/// @note Uses the vectorized lookup table validator if SSSE3 is available and FindInvalid(const char* const, size_t) otherwise.
+		///
+		inline bool IsValid(const char* const data, size_t size) {
+			if (size >= 16 && Simd::GetCpuFeatures().ssse3) return IsValidSsse3(data, size);
+			return FindInvalid(data, size) == size;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CountCodePoints-->
+		/// @brief Counts the code points of UTF-8 encoded bytes by counting every byte which is not a continuation byte (10xxxxxx).
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @return The number of code points. Stray continuation bytes of invalid UTF-8 are not counted.
+		/// @note Compares 16 bytes at a time and sums the results in byte counters, which are only widened every 255 blocks.
+		///
+		inline size_t CountCodePoints(const char* const data, size_t size) {
+			const __m128i lastContinuation = _mm_set1_epi8(static_cast<char>(0xBF));
+			size_t count = 0;
+			size_t i = 0;
+			while (i + 16 <= size) {
+				__m128i counters = _mm_setzero_si128();
+				size_t blockEnd = i + 255 * 16;
+				if (blockEnd > size) blockEnd = size;
+				for (; i + 16 <= blockEnd; i += 16) {
+					__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					// Continuation bytes are 0x80-0xBF, the 64 smallest signed chars, so every byte greater than -65 starts a code point.
+					counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(bytes, lastContinuation));
+				}
+				__m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+				count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+			}
+			for (; i < size; ++i) count += (static_cast<uint8_t>(data[i]) & 0xC0) != 0x80;
+			return count;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--SkipCodePoints-->
+		/// @brief Finds the byte offset of a code point of UTF-8 encoded bytes.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @param[in] count The number of code points to skip.
+		/// @return The offset of the first byte of the code point with the index count or size, if there are not as many code points.
+		///
+		inline size_t SkipCodePoints(const char* const data, size_t size, size_t count) {
+			const __m128i lastContinuation = _mm_set1_epi8(static_cast<char>(0xBF));
+			size_t i = 0;
+			for (; i + 16 <= size; i += 16) {
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+				uint32_t starts = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(bytes, lastContinuation)));
+				uint32_t blockCount = Simd::PopCount(starts);
+				if (blockCount > count) {
+					for (; count > 0; --count) starts &= starts - 1;
+					return i + Simd::CountTrailingZeros(starts);
+				}
+				count -= blockCount;
+			}
+			for (; i < size; ++i) {
+				if ((static_cast<uint8_t>(data[i]) & 0xC0) == 0x80) continue;
+				if (count == 0) return i;
+				--count;
+			}
+			return size;
+		}
+
+		const size_t kIndexStride = 128;		///< The number of code points between two entries of a CodePointIndex.
+
+		/// @brief A sparse index of the byte offsets of every kIndexStride-th code point, which turns a code point lookup into a short scan.
+		/// @brief Allocated as one block with malloc by CreateCodePointIndex(const char* const, size_t) and released with free.
+		///
+		struct CodePointIndex {
+			size_t codePointCount;		///< The number of code points of the indexed bytes.
+			size_t offsets[1];			///< The byte offset of code point i * kIndexStride. Left out if the bytes are ASCII.
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CreateCodePointIndex-->
+		/// @brief Creates the CodePointIndex of UTF-8 encoded bytes.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @return The created CodePointIndex, which must be released with free. If the bytes are ASCII, only codePointCount is set.
+		///
+		inline CodePointIndex* CreateCodePointIndex(const char* const data, size_t size) {
+			size_t codePointCount = CountCodePoints(data, size);
+			size_t entryCount = codePointCount == size ? 1 : (codePointCount + kIndexStride - 1) / kIndexStride;
+			if (entryCount == 0) entryCount = 1;
+			CodePointIndex* index = static_cast<CodePointIndex*>(malloc(sizeof(CodePointIndex) + (entryCount - 1) * sizeof(size_t)));
+			index->codePointCount = codePointCount;
+			if (codePointCount == size) return index;
+			index->offsets[0] = SkipCodePoints(data, size, 0);
+			for (size_t i = 1; i < entryCount; ++i) {
+				size_t previous = index->offsets[i - 1];
+				index->offsets[i] = previous + SkipCodePoints(data + previous, size - previous, kIndexStride);
+			}
+			return index;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CodePointToByteOffset-->
+		/// @brief Finds the byte offset of a code point with a CodePointIndex.
+		/// @param[in] index The CodePointIndex of the bytes.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @param[in] codePoint The index of the code point.
+		/// @return The offset of the first byte of the code point or size, if there are not as many code points.
+		///
+		inline size_t CodePointToByteOffset(const CodePointIndex& index, const char* const data, size_t size, size_t codePoint) {
+			if (codePoint >= index.codePointCount) return size;
+			if (index.codePointCount == size) return codePoint;
+			size_t offset = index.offsets[codePoint / kIndexStride];
+			return offset + SkipCodePoints(data + offset, size - offset, codePoint % kIndexStride);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--TranscodeResult-->
+		/// @brief The result of a transcoding function.
+		///
+		struct TranscodeResult {
+			size_t written;			///< The number of code units written to the destination.
+			size_t errorOffset;		///< The offset of the first invalid sequence in source code units. Equal to the source size, if the source is valid.
+		};
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--DecodeSequence-->
+		/// @brief Decodes a UTF-8 sequence, which has been checked with SequenceLength(const uint8_t*, size_t).
+		/// @param[in] bytes The bytes of the sequence.
+		/// @param[in] length The length of the sequence, 2 to 4.
+		/// @return The code point.
+		///
+		inline uint32_t DecodeSequence(const uint8_t* bytes, size_t length) {
+			if (length == 2) return (static_cast<uint32_t>(bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F);
+			if (length == 3) return (static_cast<uint32_t>(bytes[0] & 0x0F) << 12) | (static_cast<uint32_t>(bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F);
+			return (static_cast<uint32_t>(bytes[0] & 0x07) << 18) | (static_cast<uint32_t>(bytes[1] & 0x3F) << 12) | (static_cast<uint32_t>(bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--EncodeCodePoint-->
+		/// @brief Encodes a code point as UTF-8.
+		/// @param[in] codePoint The code point. Must not be a surrogate or above U+10FFFF.
+		/// @param[out] destination The buffer receiving 1 to 4 bytes.
+		/// @return The number of written bytes.
+		///
+		inline size_t EncodeCodePoint(uint32_t codePoint, char* destination) {
+			if (codePoint < 0x80) {
+				destination[0] = static_cast<char>(codePoint);
+				return 1;
+			}
+			if (codePoint < 0x800) {
+				destination[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+				destination[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 2;
+			}
+			if (codePoint < 0x10000) {
+				destination[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+				destination[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+				destination[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+				return 3;
+			}
+			destination[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+			destination[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			destination[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			destination[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+			return 4;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--Utf16Length-->
+		/// @brief Calculates the number of UTF-16 code units of UTF-8 encoded bytes.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @return The exact number of UTF-16 code units, if the bytes are valid UTF-8, and an upper bound of the valid prefix otherwise.
+		/// @note Every code point takes one code unit and every 4-byte sequence a second one, so both lead bytes and 0xF0-0xFF are counted, 16 at a time.
+		///
+		inline size_t Utf16Length(const char* const data, size_t size) {
+			const __m128i lastContinuation = _mm_set1_epi8(static_cast<char>(0xBF));
+			const __m128i fourByteLead = _mm_set1_epi8(static_cast<char>(0xF0));
+			size_t count = 0;
+			size_t i = 0;
+			while (i + 16 <= size) {
+				__m128i counters = _mm_setzero_si128();
+				size_t blockEnd = i + 127 * 16;
+				if (blockEnd > size) blockEnd = size;
+				for (; i + 16 <= blockEnd; i += 16) {
+					__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(bytes, lastContinuation));
+					counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(_mm_max_epu8(bytes, fourByteLead), bytes));
+				}
+				__m128i sums = _mm_sad_epu8(counters, _mm_setzero_si128());
+				count += static_cast<size_t>(_mm_cvtsi128_si32(sums)) + static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+			}
+			for (; i < size; ++i) {
+				uint8_t byte = static_cast<uint8_t>(data[i]);
+				count += ((byte & 0xC0) != 0x80) + (byte >= 0xF0);
+			}
+			return count;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToUtf16-->
+		/// @brief Transcodes UTF-8 to UTF-16. Runs of 16 ASCII bytes are widened with SSE2, all others are decoded one sequence at a time.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @param[out] destination The buffer receiving the UTF-16 code units. Must hold Utf16Length(const char* const, size_t) code units.
+		/// @return The number of written code units and the offset of the first invalid byte sequence. Transcoding stops in front of it.
+		///
+		inline TranscodeResult ToUtf16(const char* const data, size_t size, char16_t* destination) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+			TranscodeResult result = { 0, size };
+			size_t i = 0;
+			while (i < size) {
+				if (i + 16 <= size) {
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+					if (_mm_movemask_epi8(block) == 0) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + result.written), _mm_unpacklo_epi8(block, _mm_setzero_si128()));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + result.written + 8), _mm_unpackhi_epi8(block, _mm_setzero_si128()));
+						result.written += 16;
+						i += 16;
+						continue;
+					}
+				}
+				size_t end = i + 16 < size ? i + 16 : size;
+				while (i < end) {
+					if (bytes[i] < 0x80) {
+						destination[result.written++] = bytes[i++];
+						continue;
+					}
+					size_t length = SequenceLength(bytes + i, size - i);
+					if (length == 0) {
+						result.errorOffset = i;
+						return result;
+					}
+					uint32_t codePoint = DecodeSequence(bytes + i, length);
+					if (codePoint >= 0x10000) {
+						codePoint -= 0x10000;
+						destination[result.written++] = static_cast<char16_t>(0xD800 + (codePoint >> 10));
+						destination[result.written++] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+					} else destination[result.written++] = static_cast<char16_t>(codePoint);
+					i += length;
+				}
+			}
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--ToUtf32-->
+		/// @brief Transcodes UTF-8 to UTF-32. Runs of 16 ASCII bytes are widened with SSE2, all others are decoded one sequence at a time.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @param[out] destination The buffer receiving the code points. Must hold CountCodePoints(const char* const, size_t) code points.
+		/// @return The number of written code points and the offset of the first invalid byte sequence. Transcoding stops in front of it.
+		///
+		inline TranscodeResult ToUtf32(const char* const data, size_t size, char32_t* destination) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+			TranscodeResult result = { 0, size };
+			size_t i = 0;
+			while (i < size) {
+				if (i + 16 <= size) {
+					__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+					if (_mm_movemask_epi8(block) == 0) {
+						__m128i low = _mm_unpacklo_epi8(block, _mm_setzero_si128());
+						__m128i high = _mm_unpackhi_epi8(block, _mm_setzero_si128());
+						__m128i* target = reinterpret_cast<__m128i*>(destination + result.written);
+						_mm_storeu_si128(target, _mm_unpacklo_epi16(low, _mm_setzero_si128()));
+						_mm_storeu_si128(target + 1, _mm_unpackhi_epi16(low, _mm_setzero_si128()));
+						_mm_storeu_si128(target + 2, _mm_unpacklo_epi16(high, _mm_setzero_si128()));
+						_mm_storeu_si128(target + 3, _mm_unpackhi_epi16(high, _mm_setzero_si128()));
+						result.written += 16;
+						i += 16;
+						continue;
+					}
+				}
+				size_t end = i + 16 < size ? i + 16 : size;
+				while (i < end) {
+					if (bytes[i] < 0x80) {
+						destination[result.written++] = bytes[i++];
+						continue;
+					}
+					size_t length = SequenceLength(bytes + i, size - i);
+					if (length == 0) {
+						result.errorOffset = i;
+						return result;
+					}
+					destination[result.written++] = DecodeSequence(bytes + i, length);
+					i += length;
+				}
+			}
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LengthFromUtf16-->
+		/// @brief Calculates the number of UTF-8 bytes of UTF-16 code units, 8 code units at a time.
+		/// @param[in] data The UTF-16 code units.
+		/// @param[in] size The number of code units.
+		/// @return The exact number of bytes, if the code units are valid UTF-16, and an upper bound of the valid prefix otherwise.
+		///
+		inline size_t LengthFromUtf16(const char16_t* const data, size_t size) {
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i surrogateMask = _mm_set1_epi16(static_cast<short>(0xFC00));
+			size_t count = 0;
+			size_t i = 0;
+			while (i + 8 <= size) {
+				// Each lane adds 0 to 4 per iteration, so the 16-bit counters are widened after 4096 iterations.
+				__m128i counters = _mm_setzero_si128();
+				size_t blockEnd = i + 4096 * 8;
+				if (blockEnd > size) blockEnd = size;
+				for (; i + 8 <= blockEnd; i += 8) {
+					__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i below80 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80))), zero);
+					__m128i below800 = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xF800))), zero);
+					__m128i surrogates = _mm_and_si128(units, surrogateMask);
+					__m128i highSurrogate = _mm_cmpeq_epi16(surrogates, _mm_set1_epi16(static_cast<short>(0xD800)));
+					__m128i lowSurrogate = _mm_cmpeq_epi16(surrogates, _mm_set1_epi16(static_cast<short>(0xDC00)));
+					// 3 - (< 0x80) - (< 0x800) + high surrogate - 3 * low surrogate: a surrogate pair takes 4 bytes.
+					__m128i lengths = _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(below80, below800));
+					lengths = _mm_sub_epi16(lengths, highSurrogate);
+					lengths = _mm_add_epi16(lengths, _mm_and_si128(lowSurrogate, _mm_set1_epi16(-3)));
+					counters = _mm_add_epi16(counters, lengths);
+				}
+				__m128i sums = _mm_madd_epi16(counters, _mm_set1_epi16(1));
+				sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 8));
+				sums = _mm_add_epi32(sums, _mm_srli_si128(sums, 4));
+				count += static_cast<uint32_t>(_mm_cvtsi128_si32(sums));
+			}
+			for (; i < size; ++i) {
+				uint32_t unit = data[i];
+				if (unit < 0x80) count += 1;
+				else if (unit < 0x800) count += 2;
+				else if ((unit & 0xFC00) == 0xD800) count += 4;
+				else if ((unit & 0xFC00) != 0xDC00) count += 3;
+			}
+			return count;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FromUtf16-->
+		/// @brief Transcodes UTF-16 to UTF-8. Runs of 8 ASCII code units are narrowed with SSE2, all others are encoded one code point at a time.
+		/// @param[in] data The UTF-16 code units.
+		/// @param[in] size The number of code units.
+		/// @param[out] destination The buffer receiving the UTF-8 encoded bytes. Must hold LengthFromUtf16(const char16_t* const, size_t) bytes.
+		/// @return The number of written bytes and the offset of the first unpaired surrogate. Transcoding stops in front of it.
+		///
+		inline TranscodeResult FromUtf16(const char16_t* const data, size_t size, char* destination) {
+			TranscodeResult result = { 0, size };
+			size_t i = 0;
+			while (i < size) {
+				if (i + 8 <= size) {
+					__m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80))), _mm_setzero_si128());
+					if (_mm_movemask_epi8(ascii) == 0xFFFF) {
+						_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + result.written), _mm_packus_epi16(units, units));
+						result.written += 8;
+						i += 8;
+						continue;
+					}
+				}
+				size_t end = i + 8 < size ? i + 8 : size;
+				while (i < end) {
+					uint32_t codePoint = data[i];
+					size_t unitCount = 1;
+					if ((codePoint & 0xF800) == 0xD800) {
+						if (codePoint >= 0xDC00 || i + 1 >= size || (data[i + 1] & 0xFC00) != 0xDC00) {
+							result.errorOffset = i;
+							return result;
+						}
+						codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (data[i + 1] - 0xDC00);
+						unitCount = 2;
+					}
+					result.written += EncodeCodePoint(codePoint, destination + result.written);
+					i += unitCount;
+				}
+			}
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--LengthFromUtf32-->
+		/// @brief Calculates the number of UTF-8 bytes of code points.
+		/// @param[in] data The code points.
+		/// @param[in] size The number of code points.
+		/// @return The exact number of bytes, if the code points are valid, and an upper bound of the valid prefix otherwise.
+		///
+		inline size_t LengthFromUtf32(const char32_t* const data, size_t size) {
+			size_t count = 0;
+			for (size_t i = 0; i < size; ++i) {
+				uint32_t codePoint = data[i];
+				count += 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+			}
+			return count;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FromUtf32-->
+		/// @brief Transcodes UTF-32 to UTF-8. Runs of 8 ASCII code points are narrowed with SSE2, all others are encoded one at a time.
+		/// @param[in] data The code points.
+		/// @param[in] size The number of code points.
+		/// @param[out] destination The buffer receiving the UTF-8 encoded bytes. Must hold LengthFromUtf32(const char32_t* const, size_t) bytes.
+		/// @return The number of written bytes and the offset of the first surrogate or code point above U+10FFFF. Transcoding stops in front of it.
+		///
+		inline TranscodeResult FromUtf32(const char32_t* const data, size_t size, char* destination) {
+			TranscodeResult result = { 0, size };
+			size_t i = 0;
+			while (i < size) {
+				if (i + 8 <= size) {
+					__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+					__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 4));
+					__m128i nonAscii = _mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi32(static_cast<int>(0xFFFFFF80)));
+					if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonAscii, _mm_setzero_si128())) == 0xFFFF) {
+						__m128i words = _mm_packs_epi32(low, high);
+						_mm_storel_epi64(reinterpret_cast<__m128i*>(destination + result.written), _mm_packus_epi16(words, words));
+						result.written += 8;
+						i += 8;
+						continue;
+					}
+				}
+				size_t end = i + 8 < size ? i + 8 : size;
+				for (; i < end; ++i) {
+					uint32_t codePoint = data[i];
+					if (codePoint > 0x10FFFF || (codePoint & 0xFFFFF800) == 0xD800) {
+						result.errorOffset = i;
+						return result;
+					}
+					result.written += EncodeCodePoint(codePoint, destination + result.written);
+				}
+			}
+			return result;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FoldCodePoint-->
+		/// @brief Applies the simple case folding of the Unicode Character Database to a code point, e.g. 'A' -> 'a', U+1E9E -> U+00DF, U+03A3 -> U+03C3.
+		/// @param[in] codePoint The code point.
+		/// @return The folded code point. Code points without a folding are returned unchanged.
+		/// @note Two table lookups: the block of the code point in CaseFold::kStage1, then the difference to the folded code point in CaseFold::kStage2.
+		///
+		inline uint32_t FoldCodePoint(uint32_t codePoint) {
+			uint32_t block = codePoint >> CaseFold::kBlockShift;
+			if (block >= CaseFold::kBlockCount) return codePoint;
+			uint32_t offset = codePoint & ((1 << CaseFold::kBlockShift) - 1);
+			return static_cast<uint32_t>(static_cast<int32_t>(codePoint) + CaseFold::kStage2[(static_cast<uint32_t>(CaseFold::kStage1[block]) << CaseFold::kBlockShift) + offset]);
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FoldAscii-->
+		/// @brief Folds 16 ASCII characters: 'A'-'Z' become 'a'-'z', all others are unchanged.
+		/// @param[in] bytes The 16 characters. Must not contain bytes above 0x7F.
+		/// @return The folded characters.
+		///
+		inline __m128i FoldAscii(__m128i bytes) {
+			__m128i upper = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(bytes, _mm_set1_epi8('Z' + 1)));
+			return _mm_add_epi8(bytes, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FoldedLengthBound-->
+		/// @brief Calculates the number of bytes FoldCase(const char* const, size_t, char*) writes at most.
+		/// @param[in] size The number of bytes to be folded.
+		/// @return The upper bound of the folded size.
+		/// @note A folded sequence is at most CaseFold::kMaxGrowth bytes longer and only sequences of 2 or more bytes grow.
+		///
+		inline size_t FoldedLengthBound(size_t size) { return size + size / 2 * CaseFold::kMaxGrowth; }
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--FoldCase-->
+		/// @brief Applies the simple case folding to UTF-8 encoded bytes. 32-byte blocks of ASCII characters are folded with SSE2 without table lookups.
+		/// @param[in] data The UTF-8 encoded bytes.
+		/// @param[in] size The number of bytes.
+		/// @param[out] destination The buffer receiving the folded bytes. Must hold FoldedLengthBound(size_t) bytes and must not overlap the source.
+		/// @return The number of written bytes.
+		/// @note Invalid bytes are copied unchanged.
+		///
+		inline size_t FoldCase(const char* const data, size_t size, char* destination) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+			size_t written = 0;
+			size_t i = 0;
+			while (i < size) {
+				if (i + 32 <= size) {
+					__m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i));
+					__m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes + i + 16));
+					if (_mm_movemask_epi8(_mm_or_si128(low, high)) == 0) {
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + written), FoldAscii(low));
+						_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + written + 16), FoldAscii(high));
+						written += 32;
+						i += 32;
+						continue;
+					}
+				}
+				size_t end = i + 32 < size ? i + 32 : size;
+				while (i < end) {
+					if (bytes[i] < 0x80) {
+						destination[written++] = static_cast<char>(static_cast<uint8_t>(bytes[i] - 'A') < 26 ? bytes[i] + 0x20 : bytes[i]);
+						++i;
+						continue;
+					}
+					size_t length = SequenceLength(bytes + i, size - i);
+					if (length == 0) {
+						destination[written++] = static_cast<char>(bytes[i]);
+						++i;
+						continue;
+					}
+					written += EncodeCodePoint(FoldCodePoint(DecodeSequence(bytes + i, length)), destination + written);
+					i += length;
+				}
+			}
+			return written;
+		}
+
+		/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////	<!--CompareFolded-->
+		/// @brief Compares UTF-8 encoded bytes after applying the simple case folding to both, without allocating memory.
+		/// @param[in] left The first UTF-8 encoded bytes.
+		/// @param[in] leftSize The number of bytes of the first.
+		/// @param[in] right The second UTF-8 encoded bytes.
+		/// @param[in] rightSize The number of bytes of the second.
+		/// @return 0, if both are equal after folding.
+		/// @return A negative value, if the first folded code point which differs is lower in the first, or if the first is a prefix of the second.
+		/// @return A positive value otherwise.
+		/// @note Blocks of 16 ASCII characters are compared with SSE2. Invalid bytes compare by their value and after all code points.
+		///
+		inline int CompareFolded(const char* const left, size_t leftSize, const char* const right, size_t rightSize) {
+			const uint8_t* a = reinterpret_cast<const uint8_t*>(left);
+			const uint8_t* b = reinterpret_cast<const uint8_t*>(right);
+			size_t i = 0;
+			size_t j = 0;
+			while (i < leftSize && j < rightSize) {
+				if (i + 16 <= leftSize && j + 16 <= rightSize) {
+					__m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+					__m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+					if (_mm_movemask_epi8(_mm_or_si128(x, y)) == 0 && _mm_movemask_epi8(_mm_cmpeq_epi8(FoldAscii(x), FoldAscii(y))) == 0xFFFF) {
+						i += 16;
+						j += 16;
+						continue;
+					}
+				}
+
+				uint32_t codePoints[2];
+				const uint8_t* sides[2] = { a + i, b + j };
+				size_t remaining[2] = { leftSize - i, rightSize - j };
+				size_t lengths[2];
+				for (int side = 0; side < 2; ++side) {
+					if (sides[side][0] < 0x80) {
+						codePoints[side] = static_cast<uint8_t>(sides[side][0] - 'A') < 26 ? sides[side][0] + 0x20u : sides[side][0];
+						lengths[side] = 1;
+					} else if ((lengths[side] = SequenceLength(sides[side], remaining[side])) != 0) {
+						codePoints[side] = FoldCodePoint(DecodeSequence(sides[side], lengths[side]));
+					} else {
+						codePoints[side] = 0x110000 + sides[side][0];
+						lengths[side] = 1;
+					}
+				}
+				if (codePoints[0] != codePoints[1]) return codePoints[0] < codePoints[1] ? -1 : 1;
+				i += lengths[0];
+				j += lengths[1];
+			}
+			if (i < leftSize) return 1;
+			if (j < rightSize) return -1;
+			return 0;
+		}
+	}
+}
@@ -1,6 +1,13 @@
 #pragma once
 
+#include "PowerCsvReader.h"
+#include "PowerFileLoader.h"
+#include "PowerLineReader.h"
+#include "PowerMappedFile.h"
+#include "PowerStreamReader.h"
 #include "PowerString.h"
+#include "PowerStringBuilder.h"
+#include "PowerStringTable.h"
 
 
 namespace Power {
@@ -155,13 +162,13 @@ namespace Power {
 		toString = String::ToString(std::numeric_limits<uint64_t>::max());
 		AssertString(toString, 20, String::s_defaultCapacity, "18446744073709551615");
 		toString = String::ToString(-std::numeric_limits<float>::min());
-		AssertString(toString, 12, String::s_defaultCapacity, "-1.17549e-38");
+		AssertString(toString, 14, String::s_defaultCapacity, "-1.1754944e-38");
 		toString = String::ToString(std::numeric_limits<float>::max());
-		AssertString(toString, 11, String::s_defaultCapacity, "3.40282e+38");
+		AssertString(toString, 13, String::s_defaultCapacity, "3.4028235e+38");
 		toString = String::ToString(-std::numeric_limits<double>::min());
-		AssertString(toString, 13, String::s_defaultCapacity, "-2.22507e-308");
+		AssertString(toString, 24, String::s_defaultCapacity, "-2.2250738585072014e-308");
 		toString = String::ToString(std::numeric_limits<double>::max());
-		AssertString(toString, 12, String::s_defaultCapacity, "1.79769e+308");
+		AssertString(toString, 23, String::s_defaultCapacity, "1.7976931348623157e+308");
 	}
 
 	void TestShrinkToFit() {
@@ -264,15 +271,15 @@ namespace Power {
 		plusFloatAssignment += 0.0f;
 		AssertString(plusFloatAssignment, 1, ResizedCapacity(1, 1), "0");
 		plusFloatAssignment += -std::numeric_limits<float>::min();
-		AssertString(plusFloatAssignment, 13, ResizedCapacity(ResizedCapacity(1, 1), 13), "0-1.17549e-38");
+		AssertString(plusFloatAssignment, 15, ResizedCapacity(ResizedCapacity(1, 1), 15), "0-1.1754944e-38");
 		plusFloatAssignment += std::numeric_limits<float>::max();
-		AssertString(plusFloatAssignment, 24, ResizedCapacity(ResizedCapacity(ResizedCapacity(1, 1), 13), 24), "0-1.17549e-383.40282e+38");
+		AssertString(plusFloatAssignment, 28, ResizedCapacity(ResizedCapacity(ResizedCapacity(1, 1), 15), 28), "0-1.1754944e-383.4028235e+38");
 		plusDoubleAssignment += 0.0;
 		AssertString(plusDoubleAssignment, 1, ResizedCapacity(1, 1), "0");
 		plusDoubleAssignment += -std::numeric_limits<double>::min();
-		AssertString(plusDoubleAssignment, 14, ResizedCapacity(ResizedCapacity(1, 1), 14), "0-2.22507e-308");
+		AssertString(plusDoubleAssignment, 25, ResizedCapacity(ResizedCapacity(1, 1), 25), "0-2.2250738585072014e-308");
 		plusDoubleAssignment += std::numeric_limits<double>::max();
-		AssertString(plusDoubleAssignment, 26, ResizedCapacity(ResizedCapacity(ResizedCapacity(1, 1), 14), 26), "0-2.22507e-3081.79769e+308");
+		AssertString(plusDoubleAssignment, 48, ResizedCapacity(ResizedCapacity(ResizedCapacity(1, 1), 25), 48), "0-2.2250738585072014e-3081.7976931348623157e+308");
 	}
 
 	void TestAdditionOperators() {
@@ -329,13 +336,13 @@ namespace Power {
 		plusString = String::ToString("unsigned long long max: ") + std::numeric_limits<uint64_t>::max();
 		AssertString(plusString, 44, ResizedCapacity(45, 66), "unsigned long long max: 18446744073709551615");
 		plusString = String::ToString("float min: ") + -std::numeric_limits<float>::min();
-		AssertString(plusString, 23, ResizedCapacity(45, 66), "float min: -1.17549e-38");
+		AssertString(plusString, 25, ResizedCapacity(45, 66), "float min: -1.1754944e-38");
 		plusString = String::ToString("float max: ") + std::numeric_limits<float>::max();
-		AssertString(plusString, 22, ResizedCapacity(45, 66), "float max: 3.40282e+38");
+		AssertString(plusString, 24, ResizedCapacity(45, 66), "float max: 3.4028235e+38");
 		plusString = String::ToString("double min: ") + -std::numeric_limits<double>::min();
-		AssertString(plusString, 25, ResizedCapacity(45, 66), "double min: -2.22507e-308");
+		AssertString(plusString, 36, ResizedCapacity(45, 66), "double min: -2.2250738585072014e-308");
 		plusString = String::ToString("double max: ") + std::numeric_limits<double>::max();
-		AssertString(plusString, 24, ResizedCapacity(45, 66), "double max: 1.79769e+308");
+		AssertString(plusString, 35, ResizedCapacity(45, 66), "double max: 1.7976931348623157e+308");
 		plusString = "";
 		AssertString(plusString, 0, ResizedCapacity(45, 66), "");
 		plusString.ShrinkToFit();
@@ -1535,6 +1542,73 @@ namespace Power {
 		AssertString(trim, 0, 70 + String::s_defaultCapacity, "");
 		trim = String("dd").TrimEnd('d');
 		AssertString(trim, 0, 70 + String::s_defaultCapacity, "");
+
+		const CharSet whitespace = CharSet::Whitespace();
+		String trimSet(" \t\r\n  \v\f\t\t  \r\n \t  \t\n contains\tinner whitespace \r\n\t\t  \v  \f\r\n\t\t   \t   ");
+
+		AssertString(trimSet, 68, 68 + String::s_defaultCapacity);
+
+		trimSet.TrimEnd(whitespace);
+		AssertString(trimSet, 46, 68 + String::s_defaultCapacity, " \t\r\n  \v\f\t\t  \r\n \t  \t\n contains\tinner whitespace");
+		trimSet.TrimStart(whitespace);
+		AssertString(trimSet, 25, 68 + String::s_defaultCapacity, "contains\tinner whitespace");
+		trimSet.Trim(whitespace);
+		AssertString(trimSet, 25, 68 + String::s_defaultCapacity, "contains\tinner whitespace");
+		trimSet.Trim(CharSet("cosnae"));
+		AssertString(trimSet, 19, 68 + String::s_defaultCapacity, "tains\tinner whitesp");
+		trimSet.Trim(CharSet());
+		AssertString(trimSet, 19, 68 + String::s_defaultCapacity, "tains\tinner whitesp");
+		trimSet.Trim(CharSet("abcdefghijklmnopqrstuvwxyz\t "));
+		AssertString(trimSet, 0, 68 + String::s_defaultCapacity, "");
+		trimSet.Trim(whitespace);
+		AssertString(trimSet, 0, 68 + String::s_defaultCapacity, "");
+
+		String highBytes(static_cast<size_t>(100));
+		for (size_t i = 0; i < 40; ++i) highBytes.Concatenate(static_cast<char>(0x80 + i));
+		highBytes.Concatenate("\xFFkeep\x7F");
+		for (size_t i = 0; i < 40; ++i) highBytes.Concatenate(static_cast<char>(0xC0 - i));
+		CharSet highSet;
+		for (size_t i = 0x80; i < 0xC1; ++i) highSet.Add(static_cast<char>(i));
+		highBytes.Trim(highSet);
+		AssertString(highBytes, 6, 101, "\xFFkeep\x7F");
+	}
+
+	void TestStringView() {
+		const String source("   \t a view of this string \n   ");
+		const StringView view = source.View();
+
+		AssertString(source, 31, 31 + String::s_defaultCapacity);
+		assert(view.Data() == source.CString());
+		assert(view.Size() == 31);
+		assert(view == source.CString());
+		assert(!view.IsEmpty());
+		assert(StringView().IsEmpty());
+		assert(StringView() == "");
+
+		const StringView trimmed = view.Trim(CharSet::Whitespace());
+		assert(trimmed.Data() == source.CString() + 5);
+		assert(trimmed.Size() == 21);
+		assert(trimmed == "a view of this string");
+		assert(trimmed != "a view of this");
+		assert(trimmed[0] == 'a');
+		assert(view.Trim() == "\t a view of this string \n");
+		assert(view.TrimStart() == "\t a view of this string \n   ");
+		assert(view.TrimEnd() == "   \t a view of this string \n");
+		assert(view.TrimStart(CharSet(" \t")) == "a view of this string \n   ");
+		assert(view.TrimEnd(CharSet(" \n")) == "   \t a view of this string");
+		assert(trimmed.Trim('a').Trim('g') == " view of this strin");
+		assert(view.Trim(CharSet(" \t\nagiv")) == "ew of this strin");
+
+		assert(trimmed.Substring(7) == "of this string");
+		assert(trimmed.Substring(2, 6) == "view");
+		assert(trimmed.Substring(6, 2).IsEmpty());
+		assert(trimmed.Substring(30).IsEmpty());
+		assert(source.View(7, 11) == "view");
+		assert(source.View(7, 100) == "view of this string \n   ");
+
+		String copy(trimmed);
+		AssertString(copy, 21, 21 + String::s_defaultCapacity, "a view of this string");
+		AssertString(source, 31, 31 + String::s_defaultCapacity, "   \t a view of this string \n   ");
 	}
 
 	void TestPad() {
@@ -1579,6 +1653,29 @@ namespace Power {
 		AssertString(padString, 40, 41, "aaaaaccccccccI need some padding...ccccc");
 		padString.PadRight(45, 'a');
 		AssertString(padString, 45, ResizedCapacity(41, 45), "aaaaaccccccccI need some padding...cccccaaaaa");
+
+		padString = String("pad me");
+		AssertString(padString, 6, ResizedCapacity(41, 45), "pad me");
+		padString.PadLeft(4, "xy");
+		AssertString(padString, 6, ResizedCapacity(41, 45), "pad me");
+		padString.PadLeft(11, "xy");
+		AssertString(padString, 11, ResizedCapacity(41, 45), "xyxyxpad me");
+		padString.PadLeft(12, "");
+		AssertString(padString, 11, ResizedCapacity(41, 45), "xyxyxpad me");
+		padString.PadRight(16, String::ToString("-="));
+		AssertString(padString, 16, ResizedCapacity(41, 45), "xyxyxpad me-=-=-");
+		padString.PadRight(20, String());
+		AssertString(padString, 16, ResizedCapacity(41, 45), "xyxyxpad me-=-=-");
+		padString.PadLeft(20, padString);
+		AssertString(padString, 20, ResizedCapacity(41, 45), "xyxyxyxyxpad me-=-=-");
+		padString.PadRight(24, padString.CString() + 19, 1);
+		AssertString(padString, 24, ResizedCapacity(41, 45), "xyxyxyxyxpad me-=-=-----");
+		padString.PadRight(130, padString);
+		AssertString(padString, 130, ResizedCapacity(ResizedCapacity(41, 45), 130), "xyxyxyxyxpad me-=-=-----xyxyxyxyxpad me-=-=-----xyxyxyxyxpad me-=-=-----xyxyxyxyxpad me-=-=-----xyxyxyxyxpad me-=-=-----xyxyxyxyxp");
+		padString = String("me");
+		padString.PadLeft(140, padString.CString(), 2);
+		AssertString(padString, 140, ResizedCapacity(ResizedCapacity(41, 45), 130));
+		assert(padString.StartsWith("mememe") && padString.EndsWith("ememe"));
 	}
 
 	void TestStartsEndswith() {
@@ -1723,6 +1820,19 @@ namespace Power {
 		fillString.Fill(String::ToString("asdf"), 0, 9999);
 		AssertString(fillString, 30, 30 + String::s_defaultCapacity, "asdfasdfasdfasdfasdfasdfasdfas");
 
+		String largeFill(' ', static_cast<size_t>(300000));
+		largeFill.Fill(String::ToString("0123456"), 3);
+		AssertString(largeFill, 300000, 300000 + String::s_defaultCapacity);
+		assert(largeFill.StartsWith("   0123456012") && largeFill.EndsWith("601234"));
+		for (size_t i = 3; i < largeFill.Size(); ++i) assert(largeFill[i] == static_cast<char>('0' + (i - 3) % 7));
+
+		// Fills larger than the last level cache repeat the block with non-temporal stores.
+		const size_t streamedSize = Simd::GetCpuFeatures().lastLevelCacheSize + 100003;
+		String streamedFill(' ', streamedSize);
+		streamedFill.Fill(String::ToString("0123456"), 3);
+		AssertString(streamedFill, streamedSize);
+		for (size_t i = 3; i < streamedFill.Size(); ++i) assert(streamedFill[i] == static_cast<char>('0' + (i - 3) % 7));
+
 		fillString.Fill("0123456789");
 		AssertString(fillString, 30, 30 + String::s_defaultCapacity, "012345678901234567890123456789");
 		fillString.Fill("0123");
@@ -2112,6 +2222,1011 @@ namespace Power {
 		AssertString(joinedString, 23, String::s_defaultCapacity, "CaCConeCbCtwoCCCthreeCc");
 		joinedString = String::Join('C', mixedCStringArray, 5);
 		AssertString(joinedString, 9, String::s_defaultCapacity, "CaCConeCb");
+
+		AssertString(String::Join(String::ToString("SPACE"), stringArray, 0), 0, String::s_defaultCapacity, "");
+		AssertString(String::Join("SPACE", cStringArray, 0), 0, String::s_defaultCapacity, "");
+		AssertString(String::Join('C', cStringArray, 0), 0, String::s_defaultCapacity, "");
+
+		AssertString(String::Join(", ", stringArray), 27, 27 + String::s_defaultCapacity, "one, two, three, four, five");
+		AssertString(String::Join(String::ToString("C"), mixedCStringArray), 23, 23 + String::s_defaultCapacity, "CaCConeCbCtwoCCCthreeCc");
+		StringView viewArray[3] = { StringView("one"), StringView("twoX", 3), StringView() };
+		AssertString(String::Join(StringView("--"), viewArray), 10, 10 + String::s_defaultCapacity, "one--two--");
+		AssertString(String::Join('/', viewArray), 8, 8 + String::s_defaultCapacity, "one/two/");
+
+		String manyStrings[100];
+		for (size_t i = 0; i < 100; ++i) manyStrings[i] = String::ToString(static_cast<uint32_t>(i % 10));
+		joinedString = String::Join(',', manyStrings);
+		AssertString(joinedString, 199);
+		for (size_t i = 0; i < 100; ++i) assert(joinedString[i * 2] == '0' + static_cast<char>(i % 10));
+
+		size_t parallelJoinSize = String::s_parallelJoinSize;
+		String::s_parallelJoinSize = 0;
+		String largeString('x', static_cast<size_t>(1000));
+		String parallelArray[7] = { largeString, String(), "a", largeString, "bc", String(), largeString };
+		joinedString = String::Join("<->", parallelArray);
+		String::s_parallelJoinSize = parallelJoinSize;
+		String expectedString = largeString + "<-><->a<->" + largeString + "<->bc<-><->" + largeString;
+		AssertString(joinedString, expectedString.Size(), 0, expectedString.CString());
+	}
+
+	void TestTranslate() {
+		char table[256];
+		String translate("a,b;c d,e;f g,h;i j,k;l m,n;o p");
+		String translated(static_cast<size_t>(0));
+
+		AssertString(translate, 31, 31 + String::s_defaultCapacity, "a,b;c d,e;f g,h;i j,k;l m,n;o p");
+		AssertString(translated, 0, 1, "");
+
+		String::CreateTranslationTable(table, "", "");
+		translate.Translate(table);
+		AssertString(translate, 31, 31 + String::s_defaultCapacity, "a,b;c d,e;f g,h;i j,k;l m,n;o p");
+		String::CreateTranslationTable(table, ",; ", "_");
+		translate.Translate(table, translated);
+		AssertString(translate, 31, 31 + String::s_defaultCapacity, "a,b;c d,e;f g,h;i j,k;l m,n;o p");
+		AssertString(translated, 31, ResizedCapacity(1, 31), "a_b_c_d_e_f_g_h_i_j_k_l_m_n_o_p");
+		translate.Translate(table, CharSet(" "), translated);
+		AssertString(translated, 26, ResizedCapacity(1, 31), "a_b_cd_e_fg_h_ij_k_lm_n_op");
+		String::CreateTranslationTable(table, "abcdefghijklmnop", "ABCDEFGHIJKLMNOP");
+		translate.Translate(table);
+		AssertString(translate, 31, 31 + String::s_defaultCapacity, "A,B;C D,E;F G,H;I J,K;L M,N;O P");
+		translate.Translate(table, CharSet(",;"));
+		AssertString(translate, 21, 31 + String::s_defaultCapacity, "ABC DEF GHI JKL MNO P");
+		translate.Translate(table, CharSet(""));
+		AssertString(translate, 21, 31 + String::s_defaultCapacity, "ABC DEF GHI JKL MNO P");
+		translate.Translate(table, CharSet("ABCDEFGHIJKLMNOP "));
+		AssertString(translate, 0, 31 + String::s_defaultCapacity, "");
+		translate.Translate(table);
+		AssertString(translate, 0, 31 + String::s_defaultCapacity, "");
+
+		String::CreateTranslationTable(table, "0123456789", "#");
+		String digits("Order 1234-5678 shipped on 2016/03/09, tracking code 99A0B1C2D3E4F5.");
+		digits.Translate(table);
+		AssertString(digits, 68, 68 + String::s_defaultCapacity, "Order ####-#### shipped on ####/##/##, tracking code ##A#B#C#D#E#F#.");
+
+		for (size_t i = 0; i < 256; ++i) table[i] = static_cast<char>(i & 0x7F);
+		String highBits(static_cast<size_t>(300));
+		for (size_t i = 0; i < 300; ++i) highBits.Concatenate(static_cast<char>(i));
+		String lowBits(static_cast<size_t>(300));
+		for (size_t i = 0; i < 300; ++i) lowBits.Concatenate(static_cast<char>(i & 0x7F));
+		highBits.Translate(table);
+		AssertString(highBits, 300, 301);
+		assert(memcmp(highBits.CString(), lowBits.CString(), 300) == 0);
+
+		for (size_t i = 0; i < 256; ++i) table[i] = static_cast<char>(255 - i);
+		String reversed(static_cast<size_t>(300));
+		for (size_t i = 0; i < 300; ++i) reversed.Concatenate(static_cast<char>(255 - (i & 0xFF)));
+		String bytes(static_cast<size_t>(300));
+		for (size_t i = 0; i < 300; ++i) bytes.Concatenate(static_cast<char>(i));
+		bytes.Translate(table, translated);
+		AssertString(translated, 300, ResizedCapacity(ResizedCapacity(1, 31), 300));
+		assert(memcmp(translated.CString(), reversed.CString(), 300) == 0);
+	}
+
+	void TestUtf8() {
+		String utf8("ASCII, \xC3\xA9t\xC3\xA9, \xE2\x82\xAC, \xF0\x9F\x98\x80 and U+10FFFF \xF4\x8F\xBF\xBF");
+
+		AssertString(utf8, 41, 41 + String::s_defaultCapacity);
+		assert(utf8.IsValidUtf8());
+		assert(String().IsValidUtf8());
+
+		const char* const invalid[] = {
+			"\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xC2", "\xC2\x41", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xE2\x82", "\xED\xA0\x80",
+			"\xED\xBF\xBF", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xF0\x9F\x98", "\xFE", "\xFF"
+		};
+		for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+			String sequence(invalid[i]);
+			assert(!sequence.IsValidUtf8());
+			sequence.Insert(0, "A long ASCII prefix which moves the sequence past the first vector block ... ");
+			assert(!sequence.IsValidUtf8());
+			sequence.Concatenate(" and an ASCII suffix");
+			assert(!sequence.IsValidUtf8());
+		}
+
+		String longText(static_cast<size_t>(1000));
+		for (size_t i = 0; i < 20; ++i) longText.Concatenate("0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcde\xC3");
+		assert(!longText.IsValidUtf8());
+		longText.RemoveAll('\xC3');
+		assert(longText.IsValidUtf8());
+		longText.Insert(63, "\xE2\x82\xAC");
+		assert(longText.IsValidUtf8());
+		longText.Insert(126, "\xF0\x9F\x98\x80");
+		assert(longText.IsValidUtf8());
+		longText.Concatenate('\xF0');
+		assert(!longText.IsValidUtf8());
+
+		String destination("unchanged");
+		assert(!String::TryFromUtf8("\xED\xA0\x80", 3, destination));
+		AssertString(destination, 9, 9 + String::s_defaultCapacity, "unchanged");
+		assert(String::TryFromUtf8(utf8.CString(), utf8.Size(), destination));
+		AssertString(destination, 41, 9 + String::s_defaultCapacity, utf8.CString());
+		assert(String::TryFromUtf8(destination.CString() + 7, 7, destination));
+		AssertString(destination, 7, 9 + String::s_defaultCapacity, "\xC3\xA9t\xC3\xA9, ");
+
+		String file;
+		assert(String::TryLoadUtf8FileIntoString("test.txt", file));
+		assert(file.Size() > 0 && file.IsValidUtf8());
+		assert(!String::TryLoadUtf8FileIntoString("does not exist.txt", destination));
+		AssertString(destination, 7, 9 + String::s_defaultCapacity, "\xC3\xA9t\xC3\xA9, ");
+	}
+
+	void TestCodePoints() {
+		String text("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "b");
+
+		AssertString(text, 11, 11 + String::s_defaultCapacity);
+		assert(text.CodePointCount() == 5);
+		assert(String().CodePointCount() == 0);
+		assert(text.CodePointToByteOffset(0) == 0);
+		assert(text.CodePointToByteOffset(1) == 1);
+		assert(text.CodePointToByteOffset(2) == 3);
+		assert(text.CodePointToByteOffset(3) == 6);
+		assert(text.CodePointToByteOffset(4) == 10);
+		assert(text.CodePointToByteOffset(5) == 11);
+		assert(text.CodePointToByteOffset(500) == 11);
+		AssertString(text.SubstringByCodePoints(2), 8, 8 + String::s_defaultCapacity, "\xE2\x82\xAC\xF0\x9F\x98\x80" "b");
+		AssertString(text.SubstringByCodePoints(1, 3), 5, 5 + String::s_defaultCapacity, "\xC3\xA9\xE2\x82\xAC");
+		AssertString(text.SubstringByCodePoints(3, 1), 0, String::s_defaultCapacity, "");
+		AssertString(text.SubstringByCodePoints(9), 0, String::s_defaultCapacity, "");
+
+		String large(static_cast<size_t>(8000));
+		for (size_t i = 0; i < 1000; ++i) {
+			if (i % 3 == 0) large.Concatenate("x");
+			else if (i % 3 == 1) large.Concatenate("\xC3\xB6");
+			else large.Concatenate("\xE2\x82\xAC");
+		}
+		AssertString(large, 1999, 8001);
+		assert(large.CodePointCount() == 1000);
+		for (size_t i = 0; i <= 1000; ++i) assert(large.CodePointToByteOffset(i) == i / 3 * 6 + (i % 3 == 2 ? 3 : i % 3));
+		large.IndexCodePoints();
+		for (size_t i = 0; i <= 1000; ++i) assert(large.CodePointToByteOffset(i) == i / 3 * 6 + (i % 3 == 2 ? 3 : i % 3));
+		assert(large.CodePointCount() == 1000);
+		AssertString(large.SubstringByCodePoints(997, 999), 5, 5 + String::s_defaultCapacity, "\xC3\xB6\xE2\x82\xAC");
+
+		large.Insert(0, "\xF0\x9F\x98\x80");
+		assert(large.CodePointCount() == 1001);
+		large.IndexCodePoints();
+		assert(large.CodePointCount() == 1001);
+		assert(large.CodePointToByteOffset(1) == 4);
+		assert(large.CodePointToByteOffset(998) == 4 + 997 / 3 * 6 + 1);
+		large.ReplaceAt(0, "abcd");
+		assert(large.CodePointCount() == 1004);
+		large.IndexCodePoints();
+		assert(large.CodePointToByteOffset(4) == 4);
+		large.Fill('a');
+		assert(large.CodePointCount() == 2003);
+		assert(large.CodePointToByteOffset(1500) == 1500);
+		large.Remove(1000);
+		assert(large.CodePointToByteOffset(1500) == 1000);
+	}
+
+	void TestTranscode() {
+		const String text("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80 with an ASCII tail to take the vector path");
+		const char16_t expected16[] = { u'a', 0x00E9, 0x20AC, 0xD83D, 0xDE00, u' ', u'w' };
+		const char32_t expected32[] = { U'a', 0x00E9, 0x20AC, 0x1F600, U' ', U'w' };
+
+		AssertString(text, 53, 53 + String::s_defaultCapacity);
+		assert(text.Utf16Length() == 48);
+		char16_t utf16[48];
+		Utf8::TranscodeResult result = text.ToUtf16(utf16);
+		assert(result.written == 48 && result.errorOffset == text.Size());
+		assert(memcmp(utf16, expected16, sizeof(expected16)) == 0 && utf16[47] == u'h');
+		char32_t utf32[47];
+		assert(text.CodePointCount() == 47);
+		result = text.ToUtf32(utf32);
+		assert(result.written == 47 && result.errorOffset == text.Size());
+		assert(memcmp(utf32, expected32, sizeof(expected32)) == 0 && utf32[46] == U'h');
+
+		String converted;
+		result = String::FromUtf16(utf16, 48, converted);
+		assert(result.written == 53 && result.errorOffset == 48);
+		AssertString(converted, 53, String::s_defaultCapacity, text.CString());
+		result = String::FromUtf32(utf32, 47, converted);
+		assert(result.written == 53 && result.errorOffset == 47);
+		AssertString(converted, 53, String::s_defaultCapacity, text.CString());
+
+		const String invalid("ok\xE2\x82ok");
+		result = invalid.ToUtf16(utf16);
+		assert(result.written == 2 && result.errorOffset == 2);
+		const char16_t loneSurrogate[] = { u'o', u'k', 0xDE00, u'!' };
+		result = String::FromUtf16(loneSurrogate, 4, converted);
+		assert(result.written == 2 && result.errorOffset == 2);
+		AssertString(converted, 2, String::s_defaultCapacity, "ok");
+		const char32_t tooLarge[] = { U'o', U'k', 0x110000 };
+		result = String::FromUtf32(tooLarge, 3, converted);
+		assert(result.written == 2 && result.errorOffset == 2);
+		AssertString(converted, 2, String::s_defaultCapacity, "ok");
+	}
+
+	void TestFoldCase() {
+		String german("STRA\xE1\xBA\x9E" "E");
+		AssertString(german.FoldCase(), 7, 8 + String::s_defaultCapacity, "stra\xC3\x9F" "e");
+		assert(german.EqualsIgnoreCase("Stra\xE1\xBA\x9E" "e") && !german.EqualsIgnoreCase("strasse"));
+
+		const String greek("\xCE\xA3\xCE\x8A\xCE\xA3\xCE\xA5\xCE\xA6\xCE\x9F\xCE\xA3");
+		String folded;
+		greek.FoldCase(folded);
+		AssertString(folded, 14, String::s_defaultCapacity, "\xCF\x83\xCE\xAF\xCF\x83\xCF\x85\xCF\x86\xCE\xBF\xCF\x83");
+		assert(greek.EqualsIgnoreCase("\xCF\x83\xCE\xAF\xCF\x83\xCF\x85\xCF\x86\xCE\xBF\xCF\x82"));
+		assert(String("\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2").EqualsIgnoreCase("\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82"));
+		assert(String("\xE2\x84\xAA").EqualsIgnoreCase("k") && String("K").EqualsIgnoreCase("\xE2\x84\xAA"));
+
+		const String growing("\xC8\xBA-\xC8\xBA");
+		growing.FoldCase(folded);
+		AssertString(folded, 7, String::s_defaultCapacity, "\xE2\xB1\xA5-\xE2\xB1\xA5");
+		String invalid("A\xFF" "B");
+		AssertString(invalid.FoldCase(), 3, 3 + String::s_defaultCapacity, "a\xFF" "b");
+
+		String ascii("The Quick Brown Fox Jumps Over The Lazy Dog, Then Runs Away \xC3\x84gain");
+		const String lower("the quick brown fox jumps over the lazy dog, then runs away \xC3\xA4gain");
+		assert(ascii.EqualsIgnoreCase(lower) && ascii.CompareIgnoreCase(lower) == 0);
+		assert(ascii.CompareIgnoreCase("the quick brown fox jumps over the lazy dog, then runs away") > 0);
+		assert(ascii.CompareIgnoreCase("THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, THEN RUNS AWAY \xC3\x84GAIN!") < 0);
+		assert(ascii.CompareIgnoreCase("the quick brown fox jumps over the lazy dog, then runs away \xC3\xA5gain") < 0);
+		AssertString(ascii.FoldCase(), 66, 66 + String::s_defaultCapacity, lower.CString());
+	}
+
+	void TestNumberFormat() {
+		char expected[UINT64_MAX_CHR_COUNT];
+		String formatted;
+		uint64_t power = 1;
+		for (int digits = 1; digits <= 20; ++digits) {
+			const uint64_t values[] = { power - 1, power, power + 1, power * 9 + (power - 1) };
+			for (uint64_t value : values) {
+				snprintf(expected, UINT64_MAX_CHR_COUNT, "%llu", static_cast<unsigned long long>(value));
+				formatted = "";
+				formatted += value;
+				AssertString(formatted, strlen(expected), String::s_defaultCapacity, expected);
+				if (value <= UINT32_MAX) AssertString(String::ToString(static_cast<uint32_t>(value)), strlen(expected), strlen(expected) + String::s_defaultCapacity, expected);
+				if (value <= INT64_MAX) {
+					snprintf(expected, UINT64_MAX_CHR_COUNT, "%lld", -static_cast<long long>(value));
+					AssertString(String("=") + -static_cast<int64_t>(value), strlen(expected) + 1);
+					assert(strcmp(String(String("=") + -static_cast<int64_t>(value)).CString() + 1, expected) == 0);
+				}
+			}
+			if (digits < 20) power *= 10;
+		}
+
+		formatted = "row ";
+		formatted += static_cast<int16_t>(-7);
+		formatted += ';';
+		formatted += static_cast<uint16_t>(65535);
+		AssertString(formatted, 12, String::s_defaultCapacity, "row -7;65535");
+	}
+
+	void TestFloatFormat() {
+		AssertString(String::ToString(0.1f), 3, 3 + String::s_defaultCapacity, "0.1");
+		AssertString(String::ToString(0.1), 3, 3 + String::s_defaultCapacity, "0.1");
+		AssertString(String::ToString(1.0 / 3.0), 18, 18 + String::s_defaultCapacity, "0.3333333333333333");
+		AssertString(String::ToString(-0.0), 2, 2 + String::s_defaultCapacity, "-0");
+		AssertString(String::ToString(123456789.0f), 9, 9 + String::s_defaultCapacity, "123456790");
+		AssertString(String::ToString(1e17), 5, 5 + String::s_defaultCapacity, "1e+17");
+		AssertString(String::ToString(0.0001), 6, 6 + String::s_defaultCapacity, "0.0001");
+		AssertString(String::ToString(0.00001), 5, 5 + String::s_defaultCapacity, "1e-05");
+		AssertString(String::ToString(5e-324), 6, 6 + String::s_defaultCapacity, "5e-324");
+		AssertString(String::ToString(std::numeric_limits<double>::infinity()), 3, 3 + String::s_defaultCapacity, "inf");
+		AssertString(String::ToString(-std::numeric_limits<float>::infinity()), 4, 4 + String::s_defaultCapacity, "-inf");
+		AssertString(String::ToString(std::numeric_limits<double>::quiet_NaN()), 3, 3 + String::s_defaultCapacity, "nan");
+
+		AssertString(String::ToString(1234.5, NumberFormat::FloatStyle::Scientific), 10, String::s_defaultCapacity, "1.2345e+03");
+		AssertString(String::ToString(1e21, NumberFormat::FloatStyle::Fixed), 22, String::s_defaultCapacity, "1000000000000000000000");
+		AssertString(String::ToString(0.015f, NumberFormat::FloatStyle::Fixed), 5, String::s_defaultCapacity, "0.015");
+		AssertString(String::ToString(2.0 / 3.0, NumberFormat::FloatStyle::Fixed, 3), 5, String::s_defaultCapacity, "0.667");
+		AssertString(String::ToString(1234.5, NumberFormat::FloatStyle::Scientific, 2), 8, String::s_defaultCapacity, "1.23e+03");
+		AssertString(String::ToString(1234.5, NumberFormat::FloatStyle::General, 3), 8, String::s_defaultCapacity, "1.23e+03");
+
+		String roundTrip;
+		uint64_t bits = 0x9E3779B97F4A7C15ull;
+		for (int i = 0; i < 10000; ++i) {
+			bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+			double value;
+			memcpy(&value, &bits, sizeof(value));
+			if (value != value || value - value != 0.0) continue;
+			roundTrip = "";
+			roundTrip += value;
+			assert(strtod(roundTrip.CString(), nullptr) == value && roundTrip.Size() <= DOUBLE_MAX_CHR_COUNT - 1);
+			float single = static_cast<float>(value * 1e-300);
+			roundTrip = "";
+			roundTrip += single;
+			assert(strtof(roundTrip.CString(), nullptr) == single && roundTrip.Size() <= FLOAT_MAX_CHR_COUNT - 1);
+		}
+	}
+
+	void TestNumberParse() {
+		int32_t int32Value = 7;
+		NumberParse::ParseResult result = String("-2147483648;").TryParseInt(int32Value);
+		assert(result.consumed == 11 && result.error == NumberParse::ParseError::None && int32Value == INT32_MIN);
+		result = String("2147483648").TryParseInt(int32Value);
+		assert(result.consumed == 10 && result.error == NumberParse::ParseError::OutOfRange && int32Value == INT32_MIN);
+		result = String(" 1").TryParseInt(int32Value);
+		assert(result.consumed == 0 && result.error == NumberParse::ParseError::Invalid);
+		result = String("-x").TryParseInt(int32Value);
+		assert(result.consumed == 0 && result.error == NumberParse::ParseError::Invalid);
+
+		uint64_t uint64Value = 0;
+		result = String("18446744073709551615").TryParseUInt(uint64Value);
+		assert(result.consumed == 20 && result.error == NumberParse::ParseError::None && uint64Value == UINT64_MAX);
+		result = String("18446744073709551616").TryParseUInt(uint64Value);
+		assert(result.consumed == 20 && result.error == NumberParse::ParseError::OutOfRange && uint64Value == UINT64_MAX);
+		uint32_t uint32Value = 0;
+		result = String("-1").TryParseUInt(uint32Value);
+		assert(result.consumed == 0 && result.error == NumberParse::ParseError::Invalid);
+		int64_t int64Value = 0;
+		result = StringView("-9223372036854775808,12", 23).TryParseInt(int64Value);
+		assert(result.consumed == 20 && int64Value == INT64_MIN);
+		assert(String("00001234567890123456").ToInt64() == 1234567890123456ll && String("1.5").ToInt32() == 1 && String("x").ToInt32() == 0);
+
+		double doubleValue = 0.0;
+		result = String("-1.25e-3x").TryParseDouble(doubleValue);
+		assert(result.consumed == 8 && result.error == NumberParse::ParseError::None && doubleValue == -1.25e-3);
+		result = String("1e").TryParseDouble(doubleValue);
+		assert(result.consumed == 1 && doubleValue == 1.0);
+		result = String("1e400").TryParseDouble(doubleValue);
+		assert(result.consumed == 5 && result.error == NumberParse::ParseError::OutOfRange && doubleValue == 1.0);
+		result = String("-Infinity").TryParseDouble(doubleValue);
+		assert(result.consumed == 9 && doubleValue == -std::numeric_limits<double>::infinity());
+		result = String(".").TryParseDouble(doubleValue);
+		assert(result.consumed == 0 && result.error == NumberParse::ParseError::Invalid);
+		assert(String("1e23").ToDouble() == 1e23 && String("2.2250738585072011e-308").ToDouble() == 2.2250738585072011e-308);
+		assert(String("4.9406564584124654e-324").ToDouble() == 4.9406564584124654e-324 && String("2.4703282292062327e-324").ToDouble() == 0.0);
+		assert(String("9007199254740993.00000000000000000001").ToDouble() == 9007199254740994.0);
+		assert(String("0.1").View().ToDouble() == 0.1 && String("123456789012345678901234567890").ToDouble() == 123456789012345678901234567890.0);
+
+		String roundTrip;
+		uint64_t bits = 0x2545F4914F6CDD1Dull;
+		for (int i = 0; i < 10000; ++i) {
+			bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+			double value;
+			memcpy(&value, &bits, sizeof(value));
+			if (value != value || value - value != 0.0) continue;
+			roundTrip = "";
+			roundTrip += value;
+			result = roundTrip.TryParseDouble(doubleValue);
+			assert(result.consumed == roundTrip.Size() && doubleValue == value);
+		}
+	}
+
+	void TestFormat() {
+		AssertString(Format(POWER_FORMAT("{}: {} items in {:.3f}s"), "load", 42, 1.23456), 24, 27, "load: 42 items in 1.235s");
+		AssertString(Format(POWER_FORMAT("{{{}}} {:x} {:X} {} {} {} {:.2} {:e} {} {:g}"), String("str"), 255, -255ll, 'c', true, 0.1f, "abcdef", 1234.5, 4294967289u, 1e21),
+			54, 55, "{str} ff -FF c true 0.1 ab 1.2345e+03 4294967289 1e+21");
+		AssertString(Format(POWER_FORMAT("plain")), 5, 6, "plain");
+		AssertString(Format(POWER_FORMAT("{}|{}|{:x}"), INT64_MIN, UINT64_MAX, UINT64_MAX), 58, 59, "-9223372036854775808|18446744073709551615|ffffffffffffffff");
+
+		String log(static_cast<size_t>(64));
+		log.ConcatenateFormat(POWER_FORMAT("[{}] "), StringView("info", 4));
+		log.ConcatenateFormat(POWER_FORMAT("{:.1e}"), -0.25f);
+		AssertString(log, 15, 65, "[info] -2.5e-01");
+
+		String self(static_cast<size_t>(3));
+		self.Concatenate("ab");
+		self.ConcatenateFormat(POWER_FORMAT("[{}|{}|{:.1}|{}]"), self, self.View(), self, "0123456789");
+		AssertString(self, 22, ResizedCapacity(4, 22), "ab[ab|ab|a|0123456789]");
+
+		char expected[64];
+		uint64_t bits = 0x9E3779B97F4A7C15ull;
+		for (int i = 0; i < 10000; ++i) {
+			bits = bits * 6364136223846793005ull + 1442695040888963407ull;
+			double value = static_cast<double>(static_cast<int64_t>(bits) >> 24) / 1024.0;
+			snprintf(expected, sizeof(expected), "%.3f", value);
+			assert(Format(POWER_FORMAT("{:.3f}"), value) == expected);
+			snprintf(expected, sizeof(expected), "%.0f", value);
+			assert(Format(POWER_FORMAT("{:.0f}"), value) == expected);
+		}
+	}
+
+	void TestAppendFormat() {
+		String string("id=");
+		string.AppendFormat("%d;%.2f;%s", -42, 3.14159, "abc");
+		AssertString(string, 15, 3 + String::s_defaultCapacity, "id=-42;3.14;abc");
+
+		String fit(static_cast<size_t>(5));
+		fit.AppendFormat("%05d", 7);
+		AssertString(fit, 5, 6, "00007");
+		fit.AppendFormat("%s", "0123456789");
+		AssertString(fit, 15, ResizedCapacity(6, 15), "000070123456789");
+
+		// Arguments must not point into the Power::String itself, so a copy is passed.
+		String grow(static_cast<size_t>(8));
+		grow.Concatenate("abcdefgh");
+		String copy(grow);
+		grow.AppendFormat("-%s-%s", copy.CString(), copy.CString());
+		AssertString(grow, 26, ResizedCapacity(9, 26), "abcdefgh-abcdefgh-abcdefgh");
+		String self(static_cast<size_t>(99));
+		self.Concatenate("abcdefgh");
+		self.AppendAll('-', self, '-', self);
+		AssertString(self, 26, 100, "abcdefgh-abcdefgh-abcdefgh");
+	}
+
+	void TestConcatenation() {
+		String left("left");
+		String right("right");
+		String joined = left + ' ' + right + 42 + "|" + 1.5 + true;
+		AssertString(joined, 17, 18, "left right42|1.51");
+		AssertString(left + right, 9, 10, "leftright");
+
+		String grow(static_cast<size_t>(1));
+		grow = grow + "abc" + 'd';
+		AssertString(grow, 4, ResizedCapacity(2, 4), "abcd");
+		grow = grow + static_cast<uint32_t>(grow.Size());
+		AssertString(grow, 5, ResizedCapacity(2, 4), "abcd4");
+
+		left = left + left.CString() + left;
+		AssertString(left, 12, 4 + String::s_defaultCapacity, "leftleftleft");
+		right = left + right;
+		AssertString(right, 17, 5 + String::s_defaultCapacity, "leftleftleftright");
+	}
+
+	void TestConcat() {
+		String name("name");
+		char buffer[16] = "buf";
+		AssertString(String::Concat(name, '=', 42, ", ", StringView("view", 2), buffer, 2.5, ' ', false, -7ll), 25, 26, "name=42, vibuf2.5 false-7");
+		AssertString(String::Concat(), 0, 1, "");
+
+		String all(static_cast<size_t>(2));
+		all.AppendAll("ab");
+		AssertString(all, 2, 3, "ab");
+		all.AppendAll(all, '-', all.View(), 10u);
+		AssertString(all, 9, ResizedCapacity(3, 9), "abab-ab10");
+
+		// Concat and AppendAll spell bools out, while the addition operators keep writing them as integers.
+		AssertString(String::Concat(true, ' ', false), 10, 11, "true false");
+		all.AppendAll(true);
+		AssertString(all, 13, ResizedCapacity(3, 9), "abab-ab10true");
+		AssertString(name + true + false, 6, 7, "name10");
+	}
+
+	void TestStringBuilder() {
+		StringBuilder builder(4);
+		assert(builder.IsEmpty());
+		AssertString(builder.Build(), 0, 1, "");
+
+		String name("name");
+		builder.Append("ab").Append(name).Append('=').Append(StringView("view", 2));
+		builder << 42 << ' ' << -2.5 << ' ' << true;
+		builder.AppendAll(", ", 18446744073709551615ull, "!");
+		assert(builder.Size() == 44);
+		AssertString(builder.Build(), 44, 45, "abname=vi42 -2.5 true, 18446744073709551615!");
+
+		builder.Clear();
+		assert(builder.IsEmpty());
+		String large;
+		for (int i = 0; i < 1000; ++i) {
+			builder.Append("0123456789", 10);
+			large.Concatenate("0123456789", 10);
+		}
+		AssertString(builder.Build(), 10000, 10001, large.CString());
+
+		FILE* file = tmpfile();
+		assert(file != nullptr);
+		assert(builder.WriteTo(file));
+		fflush(file);
+		assert(builder.WriteTo(_fileno(file)));
+		rewind(file);
+		char buffer[20001];
+		assert(fread(buffer, 1, sizeof(buffer), file) == 20000);
+		assert(memcmp(buffer, large.CString(), 10000) == 0);
+		assert(memcmp(buffer + 10000, large.CString(), 10000) == 0);
+		fclose(file);
+	}
+
+	void AssertParts(const SplitRange& parts, const char* const* expected, size_t count) {
+		size_t i = 0;
+		for (SplitRange::Iterator part = parts.begin(); part != parts.end(); ++part, ++i) {
+			assert(i < count);
+			assert(*part == expected[i]);
+		}
+		assert(i == count);
+		assert(parts.Count() == count);
+	}
+
+	void TestSplit() {
+		const char* fields[] = { "a", "", "bc", "", "" };
+		AssertParts(StringView("a,,bc,,").Split(','), fields, 5);
+		const char* nonEmptyFields[] = { "a", "bc" };
+		AssertParts(StringView("a,,bc,,").Split(',', SplitOptions::RemoveEmpty), nonEmptyFields, 2);
+		const char* limitedFields[] = { "a", "", "bc,," };
+		AssertParts(StringView("a,,bc,,").Split(',', SplitOptions::None, 2), limitedFields, 3);
+		const char* limitedNonEmptyFields[] = { "a", "bc", "," };
+		AssertParts(StringView("a,,bc,,").Split(',', SplitOptions::RemoveEmpty, 2), limitedNonEmptyFields, 3);
+		const char* whole[] = { "a,b" };
+		AssertParts(StringView("a,b").Split(',', SplitOptions::None, 0), whole, 1);
+		const char* empty[] = { "" };
+		AssertParts(StringView().Split(','), empty, 1);
+		AssertParts(StringView().Split(',', SplitOptions::RemoveEmpty), nullptr, 0);
+
+		const char* trimmedFields[] = { "one", "two words", "three" };
+		AssertParts(StringView(" one ;\ttwo words ; ;three\n").Split(';', SplitOptions::Trim | SplitOptions::RemoveEmpty), trimmedFields, 3);
+		const char* textFields[] = { "key", "value", "", "end" };
+		AssertParts(StringView("key::value::::end").Split(StringView("::")), textFields, 4);
+		const char* unsplit[] = { "a::b" };
+		AssertParts(StringView("a::b").Split(StringView("")), unsplit, 1);
+		const char* setFields[] = { "alpha", "beta", "gamma", "delta" };
+		AssertParts(StringView("alpha beta\tgamma\r\ndelta").Split(CharSet::Whitespace(), SplitOptions::RemoveEmpty), setFields, 4);
+
+		String line("id;name;;value");
+		const char* lineFields[] = { "id", "name", "", "value" };
+		AssertParts(line.Split(';'), lineFields, 4);
+		AssertParts(line.Split(";"), lineFields, 4);
+		AssertParts(line.Split(String(";")), lineFields, 4);
+		AssertParts(line.Split(CharSet(";,")), lineFields, 4);
+
+		// Long inputs cross the 16-byte blocks of the vectorized scan.
+		String csv;
+		String expected[200];
+		for (size_t i = 0; i < 200; ++i) {
+			expected[i] = String::ToString(static_cast<uint32_t>(i * i * 37));
+			if (i % 7 == 0) expected[i] = "";
+			if (i > 0) csv += (i % 3 == 0) ? ";" : ",";
+			csv += expected[i];
+		}
+		String commaJoined = String::Join(',', expected);
+		String textJoined = String::Join("<>", expected);
+		for (int kind = 0; kind < 3; ++kind) {
+			SplitRange parts = kind == 0 ? csv.Split(CharSet(",;")) : kind == 1 ? commaJoined.Split(',') : textJoined.Split("<>");
+			size_t i = 0;
+			for (const StringView& part : parts) {
+				assert(i < 200);
+				assert(part == expected[i].CString());
+				++i;
+			}
+			assert(i == 200);
+		}
+	}
+
+	void AssertRow(const CsvRow& row, const char* const* expected, size_t count) {
+		assert(row.Size() == count);
+		for (size_t i = 0; i < count; ++i) assert(row[i] == expected[i]);
+	}
+
+	void TestCsvReader() {
+		CsvRow row;
+		CsvReader reader(StringView("id,name,note\r\n1,\"Doe, Jane\",\"said \"\"hi\"\"\"\n2,,\"two\nlines\"\n\n3,x,\"\"\"\""));
+		const char* header[] = { "id", "name", "note" };
+		const char* first[] = { "1", "Doe, Jane", "said \"hi\"" };
+		const char* second[] = { "2", "", "two\nlines" };
+		const char* empty[] = { "" };
+		const char* last[] = { "3", "x", "\"" };
+		assert(reader.ReadRow(row));
+		AssertRow(row, header, 3);
+		assert(reader.ReadRow(row));
+		AssertRow(row, first, 3);
+		assert(reader.ReadRow(row));
+		AssertRow(row, second, 3);
+		assert(reader.ReadRow(row));
+		AssertRow(row, empty, 1);
+		assert(reader.ReadRow(row));
+		AssertRow(row, last, 3);
+		assert(!reader.ReadRow(row));
+		assert(!CsvReader(StringView()).ReadRow(row));
+
+		CsvReader tsvReader(StringView("a\tb,c\t\"d\te\"\n"), '\t');
+		const char* tsv[] = { "a", "b,c", "d\te" };
+		assert(tsvReader.ReadRow(row));
+		AssertRow(row, tsv, 3);
+		assert(!tsvReader.ReadRow(row));
+
+		// Quoted delimiters and newlines cross the 64-byte blocks of the structural scan.
+		String csv;
+		for (uint32_t i = 0; i < 1000; ++i) {
+			csv += i;
+			csv += ",\"text, with \"\"quotes\"\"\nand ";
+			csv += i * 7;
+			csv += "\",";
+			if (i % 5 == 0) csv += "\"\"";
+			else csv += i % 3;
+			csv += i % 2 == 0 ? "\n" : "\r\n";
+		}
+		CsvReader largeReader(csv.View());
+		for (uint32_t i = 0; i < 1000; ++i) {
+			assert(largeReader.ReadRow(row));
+			assert(row.Size() == 3);
+			assert(row[0].ToInt64() == i);
+			String text = String::Concat("text, with \"quotes\"\nand ", i * 7);
+			assert(row[1] == text.CString());
+			assert(row[2].IsEmpty() == (i % 5 == 0));
+			if (i % 5 != 0) assert(row[2].ToInt64() == i % 3);
+		}
+		assert(!largeReader.ReadRow(row));
+
+		StringView parts[7];
+		CsvReader::Partition(csv.View(), 7, parts);
+		const char* position = csv.CString();
+		for (size_t i = 0; i < 7; ++i) {
+			assert(parts[i].Data() == position);
+			position += parts[i].Size();
+		}
+		assert(position == csv.CString() + csv.Size());
+
+		size_t rowCounts[4] = { 0 };
+		uint64_t sums[4] = { 0 };
+		CsvReader::ParallelForEachRow(csv.View(), [&rowCounts, &sums](size_t part, const CsvRow& partRow) {
+			++rowCounts[part];
+			sums[part] += partRow[0].ToInt64();
+		}, 4);
+		assert(rowCounts[0] + rowCounts[1] + rowCounts[2] + rowCounts[3] == 1000);
+		assert(sums[0] + sums[1] + sums[2] + sums[3] == 999 * 1000 / 2);
+	}
+
+	void AssertLines(const LineRange& lines, const char* const* expected, size_t count) {
+		size_t i = 0;
+		for (LineRange::Iterator line = lines.begin(); line != lines.end(); ++line, ++i) {
+			assert(i < count);
+			assert(*line == expected[i]);
+		}
+		assert(i == count);
+		assert(lines.Count() == count);
+	}
+
+	void TestLines() {
+		const char* lines[] = { "one", "", "two", "three\r" };
+		AssertLines(String("one\r\n\ntwo\nthree\r").Lines(), lines, 4);
+		const char* crlfLines[] = { "one", "", "two", "three" };
+		AssertLines(StringView("one\r\n\ntwo\nthree\r\n").Lines(), crlfLines, 4);
+		const char* emptyLine[] = { "" };
+		AssertLines(StringView("\n").Lines(), emptyLine, 1);
+		AssertLines(StringView("\r\n").Lines(), emptyLine, 1);
+		AssertLines(StringView().Lines(), nullptr, 0);
+
+		// The lines cross the refills of the buffer and some are longer than its initial size.
+		String text;
+		for (uint32_t i = 0; i < 1000; ++i) {
+			text += i;
+			text += ':';
+			for (uint32_t j = 0; j < i % 40; ++j) text += "abc";
+			text += i % 2 == 0 ? "\n" : "\r\n";
+		}
+		text += "last";
+		FILE* file = tmpfile();
+		assert(file != nullptr);
+		assert(fwrite(text.CString(), 1, text.Size(), file) == text.Size());
+		fflush(file);
+
+		rewind(file);
+		LineReader reader(file, 64);
+		String line;
+		LineRange::Iterator expected = text.Lines().begin();
+		while (reader.ReadLine(line)) {
+			assert(expected != text.Lines().end());
+			assert(line.View() == *expected);
+			++expected;
+		}
+		assert(expected == text.Lines().end());
+		assert(!reader.HasError());
+		assert(line == "last");
+
+		rewind(file);
+		LineReader fdReader(_fileno(file), 16);
+		StringView view;
+		size_t count = 0;
+		while (fdReader.ReadLine(view)) {
+			int32_t number = -1;
+			assert(count == 1000 ? view == "last" : view.TryParseInt(number).consumed > 0 && number == static_cast<int32_t>(count));
+			++count;
+		}
+		assert(count == 1001);
+		fclose(file);
+	}
+
+	void TestMappedFile() {
+		StringView text("one two, one\n");
+		assert(text.IndexOf('o') == 0);
+		assert(text.IndexOf('o', 1) == 6);
+		assert(text.IndexOf('x') == -1);
+		assert(text.IndexOf('o', 13) == -1);
+		assert(text.IndexOf(StringView("one"), 1) == 9);
+		assert(text.IndexOf(StringView("one\n\n")) == -1);
+		assert(text.IndexOf(StringView(), 13) == 13);
+		assert(text.Count('o') == 3);
+		assert(StringView("oooooooooooooooooooo").Count('o') == 20);
+
+		String loaded;
+		assert(String::TryLoadUtf8FileIntoString("test.txt", loaded));
+		MappedFile file("test.txt", MapOptions::Sequential | MapOptions::Populate);
+		assert(file.IsOpen());
+		assert(file.Size() == loaded.Size());
+		assert(file.View() == loaded.View());
+		assert(file.View().Count('f') == static_cast<size_t>(loaded.Count('f')));
+		assert(file.Lines().Count() == loaded.Lines().Count());
+		assert(file.Split(' ').Count() == loaded.Split(' ').Count());
+		AssertString(file.ToString(), loaded.Size(), loaded.Size() + String::s_defaultCapacity, loaded.CString());
+
+		// Written pages are private copies, so the file and other mappings of it stay unchanged.
+		MappedFile copy("test.txt", MapOptions::CopyOnWrite);
+		assert(copy.IsOpen());
+		char first = copy.Data()[0];
+		copy.MutableData()[0] = first == 'x' ? 'y' : 'x';
+		assert(copy.Data()[0] != first);
+		assert(file.Data()[0] == first);
+		copy.Close();
+		assert(!copy.IsOpen() && copy.Size() == 0 && copy.View().IsEmpty());
+		assert(copy.Open(String("test.txt"), MapOptions::Random));
+		assert(copy.Data()[0] == first);
+
+		FILE* empty = nullptr;
+		assert(!fopen_s(&empty, "mapped empty.txt", "wb"));
+		fclose(empty);
+		assert(copy.Open("mapped empty.txt"));
+		assert(copy.Size() == 0 && copy.View().IsEmpty() && copy.Lines().Count() == 0);
+		copy.Close();
+		remove("mapped empty.txt");
+
+		assert(!copy.Open("does not exist.txt"));
+		assert(!copy.IsOpen());
+	}
+
+	void TestLoadFile() {
+		FILE* fp = nullptr;
+		assert(!fopen_s(&fp, "load test.txt", "wb"));
+		assert(fwrite("a\r\nb\0c\r\n", 1, 8, fp) == 8);
+		fclose(fp);
+
+		// Binary mode keeps CRLF and the null character, and the buffer has exactly the size of the file.
+		String file(static_cast<size_t>(0));
+		File::FileResult result = String::TryLoadFile("load test.txt", file);
+		assert(result.error == File::FileError::None && result.size == 8 && result.systemError == 0);
+		assert(file.Size() == 8 && file.Capacity() == 9);
+		assert(memcmp(file.CString(), "a\r\nb\0c\r\n", 9) == 0);
+
+		String reused("a string with a larger capacity than the file");
+		size_t capacity = reused.Capacity();
+		assert(String::TryLoadFile(String("load test.txt"), reused, File::LoadOptions::Sequential | File::LoadOptions::DropCache).error == File::FileError::None);
+		assert(reused.Size() == 8 && reused.Capacity() == capacity);
+		remove("load test.txt");
+
+		String loaded;
+		assert(String::TryLoadUtf8FileIntoString("test.txt", loaded));
+		assert(String::TryLoadFile("test.txt", file).size == loaded.Size());
+		assert(file == loaded);
+
+		result = String::TryLoadFile("does not exist.txt", file);
+		assert(result.error == File::FileError::NotFound && result.size == 0 && result.systemError != 0);
+		assert(file == loaded);
+	}
+
+	void TestStreamReader() {
+		String text;
+		for (uint32_t i = 0; i < 500; ++i) {
+			text += "line ";
+			text += i;
+			text += i % 3 == 0 ? " abab\r\n" : " ab\n";
+		}
+		text += "needle at the end";
+		FILE* fp = nullptr;
+		assert(!fopen_s(&fp, "stream test.txt", "wb"));
+		assert(fwrite(text.CString(), 1, text.Size(), fp) == text.Size());
+		fclose(fp);
+
+		StreamReader closed;
+		int64_t index = 0;
+		assert(closed.IndexOf(StringView("ab"), index).error == File::FileError::ReadFailed);
+		assert(closed.Open("does not exist.txt").error == File::FileError::NotFound && !closed.IsOpen());
+
+		// A chunk size of 7 makes occurances and lines cross the chunk boundaries.
+		StreamReader reader(7);
+		assert(reader.Open(String("stream test.txt")).error == File::FileError::None && reader.IsOpen());
+
+		String chunks;
+		uint64_t expectedOffset = 0;
+		File::FileResult result = reader.ForEachChunk([&chunks, &expectedOffset](const StringView& chunk, uint64_t offset) {
+			assert(offset == expectedOffset && chunk.Size() <= 7);
+			chunks.Concatenate(chunk.Data(), chunk.Size());
+			expectedOffset += chunk.Size();
+		});
+		assert(result.error == File::FileError::None && result.size == text.Size());
+		assert(chunks == text);
+
+		assert(reader.IndexOf(StringView("needle"), index).error == File::FileError::None);
+		assert(index == text.IndexOf("needle"));
+		assert(reader.IndexOf(StringView("abab\r\nline 1 "), index).error == File::FileError::None);
+		assert(index == text.IndexOf("abab\r\nline 1 "));
+		assert(reader.IndexOf(StringView("missing"), index).size == text.Size() && index == -1);
+		assert(reader.IndexOf(StringView(), index).size == 0 && index == -1);
+
+		uint64_t count = 0;
+		assert(reader.Count(StringView("ab"), count).error == File::FileError::None);
+		assert(count == static_cast<uint64_t>(text.Count("ab")));
+		assert(reader.Count(StringView("aba"), count).error == File::FileError::None);
+		assert(count == static_cast<uint64_t>(text.Count("aba")));
+		assert(reader.Count('\n', count).size == text.Size() && count == 500);
+
+		LineRange::Iterator expected = text.Lines().begin();
+		size_t lineCount = 0;
+		reader.ForEachLine([&expected, &lineCount](const StringView& line) {
+			assert(line == *expected);
+			++expected;
+			++lineCount;
+		});
+		assert(lineCount == 501);
+		reader.Close();
+		assert(!reader.IsOpen());
+		remove("stream test.txt");
+	}
+
+	void TestFileLoader() {
+		String paths[21];
+		String contents[21];
+		for (uint32_t i = 0; i < 20; ++i) {
+			paths[i] = String::Concat("loader test ", i, ".txt");
+			// The first file is empty, as files without a size are read until their end.
+			for (uint32_t j = 0; j < i * 50; ++j) contents[i] += j;
+			FILE* fp = nullptr;
+			assert(!fopen_s(&fp, paths[i].CString(), "wb"));
+			assert(fwrite(contents[i].CString(), 1, contents[i].Size(), fp) == contents[i].Size());
+			fclose(fp);
+		}
+		paths[20] = "does not exist.txt";
+
+		// The files are loaded through io_uring where it is available and with worker threads.
+		const File::LoadOptions options[] = { File::LoadOptions::Sequential, File::LoadOptions::Sequential | File::LoadOptions::Threads };
+		for (uint32_t k = 0; k < 2; ++k) {
+			String loaded[21];
+			File::FileResult results[21];
+			assert(!FileLoader::LoadFiles(paths, 21, loaded, results, 4, options[k]));
+			for (uint32_t i = 0; i < 20; ++i) {
+				assert(results[i].error == File::FileError::None && results[i].size == contents[i].Size());
+				assert(loaded[i] == contents[i]);
+			}
+			assert(results[20].error == File::FileError::NotFound);
+			assert(loaded[20].IsEmpty());
+			assert(FileLoader::LoadFiles(paths, 20, loaded, nullptr, 0, options[k]));
+
+			std::atomic<size_t> totalSize(0);
+			std::atomic<size_t> calls(0);
+			FileLoader::ForEachFile(paths, 21, [&totalSize, &calls, &contents](size_t index, const String& data, const File::FileResult& result) {
+				++calls;
+				if (index == 20) assert(result.error == File::FileError::NotFound && data.IsEmpty());
+				else assert(data == contents[index]);
+				totalSize += data.Size();
+			}, 3, options[k]);
+			size_t expectedSize = 0;
+			for (uint32_t i = 0; i < 20; ++i) expectedSize += contents[i].Size();
+			assert(calls == 21 && totalSize == expectedSize);
+
+			const char* cStringPaths[] = { paths[3].CString(), paths[7].CString() };
+			assert(FileLoader::LoadFiles(cStringPaths, 2, loaded, nullptr, 0, options[k]));
+			assert(loaded[0] == contents[3] && loaded[1] == contents[7]);
+
+			String asyncLoaded[21];
+			std::future<bool> pending = FileLoader::LoadFilesAsync(paths, 21, asyncLoaded, results, 2, options[k]);
+			assert(!pending.get());
+			for (uint32_t i = 0; i < 20; ++i) assert(asyncLoaded[i] == contents[i]);
+			assert(results[20].error == File::FileError::NotFound && asyncLoaded[20].IsEmpty());
+		}
+		for (uint32_t i = 0; i < 20; ++i) remove(paths[i].CString());
+	}
+
+	void TestSaveToFile() {
+		String text("first line\r\nsecond line\n");
+		File::FileResult result = text.SaveToFile("save test.txt");
+		assert(result.error == File::FileError::None && result.size == text.Size());
+		String loaded;
+		assert(String::TryLoadFile("save test.txt", loaded).error == File::FileError::None);
+		assert(loaded == text);
+
+		String replacement("replaced");
+		result = replacement.SaveToFile(String("save test.txt"), File::SaveOptions::AtomicReplace | File::SaveOptions::Sync);
+		assert(result.error == File::FileError::None && result.size == 8);
+		assert(String::TryLoadFile("save test.txt", loaded).size == 8);
+		assert(loaded == replacement);
+
+		// 200 elements and their seperators need several batches of writev.
+		String elements[200];
+		for (uint32_t i = 0; i < 200; ++i) elements[i] = String::Concat("element ", i);
+		result = String::SaveJoinedToFile("save test.txt", StringView(", "), elements, File::SaveOptions::AtomicReplace);
+		String joined = String::Join(", ", elements);
+		assert(result.error == File::FileError::None && result.size == joined.Size());
+		assert(String::TryLoadFile("save test.txt", loaded).error == File::FileError::None);
+		assert(loaded == joined);
+
+		// Large elements are written from where they are, so there are more than 64 parts with small seperators in between.
+		String largeElements[100];
+		for (uint32_t i = 0; i < 100; ++i) {
+			for (uint32_t j = 0; j < 500; ++j) largeElements[i] += i % 2 == 0 ? "0123456789" : "abcdefghij";
+		}
+		result = String::SaveJoinedToFile("save test.txt", StringView("\n"), largeElements);
+		joined = String::Join('\n', largeElements);
+		assert(result.error == File::FileError::None && result.size == joined.Size());
+		assert(String::TryLoadFile("save test.txt", loaded).error == File::FileError::None);
+		assert(loaded == joined);
+
+		const char* parts[] = { "a", "", "bc", "def" };
+		assert(String::SaveAllToFile("save test.txt", parts).size == 6);
+		assert(String::TryLoadFile("save test.txt", loaded).error == File::FileError::None);
+		assert(loaded == "abcdef");
+
+		assert(String().SaveToFile("save test.txt").size == 0);
+		assert(String::TryLoadFile("save test.txt", loaded).error == File::FileError::None);
+		assert(loaded.IsEmpty());
+#ifndef _WIN32
+		// The replaced file keeps its permissions.
+		struct stat status;
+		chmod("save test.txt", 0600);
+		assert(text.SaveToFile("save test.txt", File::SaveOptions::AtomicReplace).error == File::FileError::None);
+		assert(stat("save test.txt", &status) == 0 && (status.st_mode & 0777) == 0600);
+#endif
+		remove("save test.txt");
+
+		assert(text.SaveToFile("does not exist/save test.txt").error == File::FileError::NotFound);
+		assert(text.SaveToFile("does not exist/save test.txt", File::SaveOptions::AtomicReplace).error == File::FileError::NotFound);
+
+		FILE* file = tmpfile();
+		assert(file != nullptr);
+		assert(text.WriteTo(file));
+		fflush(file);
+		assert(replacement.WriteTo(_fileno(file)));
+		rewind(file);
+		char buffer[64];
+		assert(fread(buffer, 1, sizeof(buffer), file) == text.Size() + replacement.Size());
+		assert(memcmp(buffer, "first line\r\nsecond line\nreplaced", text.Size() + replacement.Size()) == 0);
+		fclose(file);
+	}
+
+	void TestStringTable() {
+		assert(Simd::Crc32c(0, "123456789", 9) == 0xE3069283);
+		assert(Simd::Crc32c(Simd::Crc32c(0, "1234", 4), "56789", 5) == 0xE3069283);
+
+		// Empty strings and strings containing '\0' are stored as they are.
+		String strings[1000];
+		for (uint32_t i = 0; i < 1000; ++i) {
+			if (i % 7 != 0) strings[i] = String::Concat("string ", i);
+		}
+		strings[1] = String("a\0b", static_cast<size_t>(3));
+		File::FileResult result = StringTable::Write("table test.pst", strings);
+		assert(result.error == File::FileError::None);
+
+		StringTable table;
+		assert(table.Open("table test.pst") == StringTableError::None);
+		assert(table.Size() == 1000);
+		for (uint32_t i = 0; i < 1000; ++i) assert(table[i] == StringView(strings[i].CString(), strings[i].Size()));
+		assert(table[1].Size() == 3 && table[0].IsEmpty());
+		assert(table.Open("table test.pst", false) == StringTableError::None);
+		assert(table.Size() == 1000 && table[999] == "string 999");
+		table.Close();
+		assert(table.Size() == 0);
+
+		String loaded;
+		assert(String::TryLoadFile("table test.pst", loaded).size == result.size);
+		assert(table.Open(StringView(loaded.CString(), loaded.Size())) == StringTableError::None);
+		assert(table.Size() == 1000 && table[500] == "string 500");
+
+		char* data = static_cast<char*>(malloc(loaded.Size()));
+		memcpy(data, loaded.CString(), loaded.Size());
+		data[loaded.Size() - 1] ^= 1;
+		assert(table.Open(StringView(data, loaded.Size())) == StringTableError::ChecksumMismatch);
+		assert(table.Size() == 0);
+		assert(table.Open(StringView(data, loaded.Size()), false) == StringTableError::None);
+		data[loaded.Size() - 1] ^= 1;
+		assert(table.Open(StringView(data, loaded.Size() - 1)) == StringTableError::InvalidFormat);
+		assert(table.Open(StringView(data, 16)) == StringTableError::InvalidFormat);
+		data[4] = 2;
+		assert(table.Open(StringView(data, loaded.Size())) == StringTableError::UnsupportedVersion);
+		data[4] = 0;
+		assert(table.Open(StringView(data, loaded.Size())) == StringTableError::InvalidFormat);
+		data[4] = 1;
+		data[12] = 1;
+		assert(table.Open(StringView(data, loaded.Size()), false) == StringTableError::InvalidFormat);
+		data[0] = 'X';
+		assert(table.Open(StringView(data, loaded.Size())) == StringTableError::InvalidFormat);
+		free(data);
+		table.Close();
+
+		const char* cStrings[] = { "first", "", "third" };
+		assert(StringTable::Write("table test.pst", cStrings).error == File::FileError::None);
+		assert(table.Open("table test.pst") == StringTableError::None);
+		assert(table.Size() == 3 && table[0] == "first" && table[1].IsEmpty() && table[2] == "third");
+
+		// A mapped file can't be replaced on Windows.
+		table.Close();
+		// The lines of a view are a range of Power::StringViews too.
+		assert(StringTable::Write("table test.pst", StringView("one\ntwo\n").Lines()).error == File::FileError::None);
+		assert(table.Open("table test.pst") == StringTableError::None);
+		assert(table.Size() == 2 && table[1] == "two");
+		table.Close();
+		assert(StringTable::Write("table test.pst", StringView().Lines()).error == File::FileError::None);
+		assert(table.Open("table test.pst") == StringTableError::None);
+		assert(table.Size() == 0);
+		table.Close();
+		remove("table test.pst");
+		assert(table.Open("table test.pst") == StringTableError::OpenFailed);
 	}
 
 	void RunUnitTests() {
@@ -2136,10 +3251,33 @@ namespace Power {
 		TestReplace();
 		TestReplaceAt();
 		TestTrim();
+		TestStringView();
 		TestPad();
 		TestStartsEndswith();
 		TestFill();
 		TestSplitAt();
 		TestJoin();
+		TestTranslate();
+		TestUtf8();
+		TestCodePoints();
+		TestTranscode();
+		TestFoldCase();
+		TestNumberFormat();
+		TestFloatFormat();
+		TestNumberParse();
+		TestFormat();
+		TestAppendFormat();
+		TestConcatenation();
+		TestConcat();
+		TestStringBuilder();
+		TestSplit();
+		TestCsvReader();
+		TestLines();
+		TestMappedFile();
+		TestLoadFile();
+		TestStreamReader();
+		TestFileLoader();
+		TestSaveToFile();
+		TestStringTable();
 	}
 }
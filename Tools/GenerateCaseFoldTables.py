@@ -0,0 +1,119 @@
+"""Generates StringClass/PowerCaseFoldTables.h, the simple case folding tables used by Power::Utf8::FoldCodePoint.
+
+The mapping is the simple case folding (status C and S) of the Unicode Character Database.
+If a path to CaseFolding.txt is passed, it is read from there. Otherwise it is derived from the
+unicodedata module of the running Python: the full folding is used, if it is a single code point,
+then the lower case mapping, if it is a single code point, and the code point itself otherwise.
+
+The table is split into blocks of 128 code points. Stage 1 maps a block to one of the distinct
+blocks of stage 2, which stores the difference between the folded and the original code point.
+
+Usage: python Tools/GenerateCaseFoldTables.py [CaseFolding.txt]
+"""
+
+import os
+import sys
+import unicodedata
+
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+
+def read_case_folding(path):
+	folding = {}
+	with open(path, encoding="utf-8") as file:
+		for line in file:
+			line = line.split("#", 1)[0].strip()
+			if not line:
+				continue
+			code, status, mapping = [field.strip() for field in line.split(";")[:3]]
+			if status in ("C", "S"):
+				folding[int(code, 16)] = int(mapping, 16)
+	return folding
+
+
+def derive_case_folding():
+	folding = {}
+	for code in range(0x110000):
+		if 0xD800 <= code <= 0xDFFF:
+			continue
+		char = chr(code)
+		folded = char.casefold()
+		if len(folded) != 1:
+			folded = char.lower()
+		if len(folded) == 1 and folded != char:
+			folding[code] = ord(folded)
+	return folding
+
+
+def build_tables(folding):
+	block_count = (max(folding) >> BLOCK_SHIFT) + 1
+	blocks = [[0] * BLOCK_SIZE]
+	block_index = {tuple(blocks[0]): 0}
+	stage1 = []
+	for block in range(block_count):
+		deltas = [folding.get((block << BLOCK_SHIFT) + i, (block << BLOCK_SHIFT) + i) - ((block << BLOCK_SHIFT) + i) for i in range(BLOCK_SIZE)]
+		key = tuple(deltas)
+		if key not in block_index:
+			block_index[key] = len(blocks)
+			blocks.append(deltas)
+		stage1.append(block_index[key])
+	assert len(blocks) <= 256
+	return stage1, [delta for block in blocks for delta in block]
+
+
+def format_array(values, per_line):
+	lines = []
+	for i in range(0, len(values), per_line):
+		lines.append("\t\t\t" + ", ".join(str(value) for value in values[i:i + per_line]) + ",")
+	return "\n".join(lines)
+
+
+def main():
+	if len(sys.argv) > 1:
+		folding = read_case_folding(sys.argv[1])
+		source = os.path.basename(sys.argv[1])
+	else:
+		folding = derive_case_folding()
+		source = "Python unicodedata " + unicodedata.unidata_version
+	stage1, stage2 = build_tables(folding)
+	max_growth = max(len(chr(target).encode("utf-8")) - len(chr(code).encode("utf-8")) for code, target in folding.items())
+
+	output = """#pragma once
+
+#include <inttypes.h>
+
+// Generated by Tools/GenerateCaseFoldTables.py from {source}. Do not edit.
+
+
+namespace Power {{
+	namespace CaseFold {{
+		const uint32_t kBlockShift = {shift};			///< log2 of the number of code points per block.
+		const uint32_t kBlockCount = {block_count};		///< The number of blocks in kStage1. All code points behind them fold to themselves.
+		const uint32_t kMaxGrowth = {max_growth};			///< The maximum number of bytes a folded UTF-8 sequence is longer than the original.
+		const uint32_t kMappingCount = {mapping_count};	///< The number of code points which don't fold to themselves.
+
+		/// @brief Maps the block of a code point (codePoint >> kBlockShift) to its block in kStage2.
+		///
+		const uint8_t kStage1[kBlockCount] = {{
+{stage1}
+		}};
+
+		/// @brief The difference between the folded and the original code point, 1 << kBlockShift entries per block.
+		///
+		const int32_t kStage2[{stage2_size}] = {{
+{stage2}
+		}};
+	}}
+}}
+""".format(source=source, shift=BLOCK_SHIFT, block_count=len(stage1), max_growth=max_growth, mapping_count=len(folding),
+		stage1=format_array(stage1, 32), stage2_size=len(stage2), stage2=format_array(stage2, 16))
+
+	path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "StringClass", "PowerCaseFoldTables.h")
+	with open(path, "w", newline="\n") as file:
+		file.write(output)
+	print("Wrote {} mappings in {} blocks ({} distinct) to {}".format(len(folding), len(stage1), len(stage2) // BLOCK_SIZE, os.path.normpath(path)))
+
+
+if __name__ == "__main__":
+	main()
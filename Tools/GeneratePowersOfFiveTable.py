@@ -0,0 +1,70 @@
+"""Generates StringClass/PowerPowersOfFive.h, the 128-bit powers of five used by Power::NumberParse::ComputeDouble.
+
+Entry q holds the 128 most significant bits of 5^q for q from -342 to 308. Positive powers are
+truncated, negative powers are the reciprocals 2^b / 5^-q rounded up, as described by
+Daniel Lemire in "Number Parsing at a Gigabyte per Second".
+
+Usage: python Tools/GeneratePowersOfFiveTable.py
+"""
+
+import os
+
+SMALLEST_POWER = -342
+LARGEST_POWER = 308
+
+
+def power_of_five_128(q):
+	if q >= 0:
+		power = 5 ** q
+		while power < (1 << 127):
+			power *= 2
+		while power >= (1 << 128):
+			power //= 2
+		return power
+	power = 5 ** -q
+	z = power.bit_length()
+	if (1 << (z - 1)) == power:
+		z -= 1
+	if q >= -27:
+		return (1 << (z + 127)) // power + 1
+	value = (1 << (2 * z + 128)) // power + 1
+	while value >= (1 << 128):
+		value //= 2
+	return value
+
+
+def main():
+	lines = []
+	for q in range(SMALLEST_POWER, LARGEST_POWER + 1):
+		value = power_of_five_128(q)
+		lines.append("\t\t\t0x{:016X}ull, 0x{:016X}ull,\t// 5^{}".format(value >> 64, value & ((1 << 64) - 1), q))
+
+	output = """#pragma once
+
+#include <inttypes.h>
+
+// Generated by Tools/GeneratePowersOfFiveTable.py. Do not edit.
+
+
+namespace Power {{
+	namespace NumberParse {{
+		const int32_t kSmallestPowerOfFive = {smallest};	///< The exponent of the first entry of kPowersOfFive.
+		const int32_t kLargestPowerOfFive = {largest};		///< The exponent of the last entry of kPowersOfFive.
+
+		/// @brief The 128 most significant bits of 5^q, high and low half, for q from kSmallestPowerOfFive to kLargestPowerOfFive.
+		///
+		const uint64_t kPowersOfFive[{size}] = {{
+{table}
+		}};
+	}}
+}}
+""".format(smallest=SMALLEST_POWER, largest=LARGEST_POWER, size=2 * (LARGEST_POWER - SMALLEST_POWER + 1), table="\n".join(lines))
+
+	path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "StringClass", "PowerPowersOfFive.h")
+	with open(path, "w", newline="\n") as file:
+		file.write(output)
+	print("Wrote {} powers of five to {}".format(LARGEST_POWER - SMALLEST_POWER + 1, os.path.normpath(path)))
+
+
+if __name__ == "__main__":
+	main()